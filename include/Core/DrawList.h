@@ -0,0 +1,127 @@
+#pragma once
+
+#include <SFML/Graphics.hpp>
+#include <cstddef>
+#include <memory>
+#include <variant>
+#include <vector>
+
+namespace FishGame
+{
+    class DrawList;
+
+    // Counterpart of sf::Drawable for anything drawn from the simulation
+    // thread: it records itself into a DrawList instead of issuing GL calls
+    class Renderable
+    {
+    public:
+        virtual ~Renderable() = default;
+
+    protected:
+        friend class DrawList;
+        virtual void draw(DrawList& target, sf::RenderStates states) const = 0;
+    };
+
+    // Drawing cached in an offscreen texture. The simulation thread records
+    // new content only when what it shows changes; the render thread redraws
+    // the texture the first time it is handed that content and otherwise
+    // just blits it.
+    class RenderLayer
+    {
+    public:
+        RenderLayer(const sf::Color& clearColor, const sf::BlendMode& blitMode);
+
+        // Starts new, empty content for a texture of the given size. Render
+        // snapshots that still hold the previous content keep it alive.
+        DrawList& record(sf::Vector2u size, bool smooth = false);
+        bool hasContent() const noexcept { return m_content != nullptr; }
+
+    private:
+        friend class DrawList;
+        struct Cache;
+
+        std::shared_ptr<Cache> m_cache;         // touched by the render thread only
+        std::shared_ptr<DrawList> m_content;    // never changed once recorded
+        sf::Color m_clearColor;
+        sf::BlendMode m_blitMode;
+        bool m_smooth{ false };
+    };
+
+    // One frame's drawing as value copies of the SFML primitives (transforms,
+    // texture rects, colours, strings) plus view changes, recorded by the
+    // simulation thread and replayed onto a real target by the render
+    // thread. Mirrors the parts of sf::RenderTarget the game draws with, so
+    // drawing code records into it unchanged. Textures and fonts are held by
+    // pointer and must outlive every snapshot that uses them; the game's all
+    // live in resource holders owned by Game.
+    class DrawList
+    {
+    public:
+        DrawList() = default;
+        explicit DrawList(sf::Vector2u size);
+
+        // Empties the list, keeping its storage, and restarts recording for
+        // a target of the given size under its default view
+        void reset(sf::Vector2u size);
+
+        void draw(const Renderable& renderable, const sf::RenderStates& states = sf::RenderStates::Default);
+        void draw(const sf::Sprite& sprite, const sf::RenderStates& states = sf::RenderStates::Default);
+        void draw(const sf::Text& text, const sf::RenderStates& states = sf::RenderStates::Default);
+        void draw(const sf::RectangleShape& shape, const sf::RenderStates& states = sf::RenderStates::Default);
+        void draw(const sf::CircleShape& shape, const sf::RenderStates& states = sf::RenderStates::Default);
+        void draw(const sf::ConvexShape& shape, const sf::RenderStates& states = sf::RenderStates::Default);
+        void draw(const sf::VertexArray& vertices, const sf::RenderStates& states = sf::RenderStates::Default);
+        void draw(const sf::Vertex* vertices, std::size_t vertexCount, sf::PrimitiveType type,
+                  const sf::RenderStates& states = sf::RenderStates::Default);
+
+        // Stretches the layer over a (0, 0)-anchored area of the given size
+        void draw(const RenderLayer& layer, sf::Vector2f size,
+                  const sf::RenderStates& states = sf::RenderStates::Default);
+
+        void setView(const sf::View& view);
+        const sf::View& getView() const noexcept { return m_view; }
+        const sf::View& getDefaultView() const noexcept { return m_defaultView; }
+        sf::Vector2u getSize() const noexcept { return m_size; }
+
+        bool empty() const noexcept { return m_commands.empty(); }
+
+        // Issues the recorded draws; render thread only. base is applied
+        // under every recorded transform.
+        void replay(sf::RenderTarget& target, const sf::RenderStates& base = sf::RenderStates::Default) const;
+
+    private:
+        struct VertexRange
+        {
+            std::size_t first;
+            std::size_t count;
+            sf::PrimitiveType type;
+        };
+
+        struct LayerBlit
+        {
+            std::shared_ptr<RenderLayer::Cache> cache;
+            std::shared_ptr<const DrawList> content;
+            sf::Vector2f area;
+            sf::Color clearColor;
+            sf::BlendMode blitMode;
+            bool smooth;
+        };
+
+        using Primitive = std::variant<sf::View, sf::Sprite, sf::Text, sf::RectangleShape,
+            sf::CircleShape, sf::ConvexShape, VertexRange, LayerBlit>;
+
+        struct Command
+        {
+            Primitive primitive;
+            sf::RenderStates states;
+        };
+
+        static void replayLayer(const LayerBlit& blit, sf::RenderTarget& target, sf::RenderStates states);
+
+        std::vector<Command> m_commands;
+        std::vector<sf::Vertex> m_vertices;    // shared by every VertexRange
+        sf::Vector2u m_size;
+        sf::View m_defaultView;
+        sf::View m_view;
+    };
+}
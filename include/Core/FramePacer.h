@@ -0,0 +1,40 @@
+#pragma once
+
+#include <chrono>
+
+namespace FishGame
+{
+    enum class PacingMode
+    {
+        Limiter,    // FramePacer sleeps, then spins to the deadline
+        VSync,      // the driver blocks in display()
+        Unlimited
+    };
+
+    // Holds frames to a steady rate. sf::Window::setFramerateLimit relies on
+    // a single coarse sleep, so frames land a millisecond or two late and
+    // unevenly; this sleeps for most of the interval on a steady clock and
+    // spin-waits the remainder.
+    class FramePacer
+    {
+    public:
+        explicit FramePacer(unsigned int targetRate);
+
+        void setTargetRate(unsigned int targetRate);
+        unsigned int getTargetRate() const noexcept { return m_targetRate; }
+
+        void setMode(PacingMode mode) noexcept { m_mode = mode; }
+        PacingMode getMode() const noexcept { return m_mode; }
+
+        // Blocks until the next frame is due; returns at once unless limiting
+        void waitForNextFrame();
+
+    private:
+        using Clock = std::chrono::steady_clock;
+
+        PacingMode m_mode{ PacingMode::Limiter };
+        unsigned int m_targetRate{ 0 };
+        Clock::duration m_interval{};
+        Clock::time_point m_deadline{};
+    };
+}
@@ -0,0 +1,28 @@
+#pragma once
+
+#include "GameConstants.h"
+#include <array>
+#include <cstdint>
+
+namespace FishGame
+{
+    // Fixed-bucket histogram of frame times; percentiles are read back at
+    // bucket resolution without keeping or sorting individual samples
+    class FrameTimeHistogram
+    {
+    public:
+        void record(sf::Time frameTime);
+        void clear();
+
+        // Upper edge of the bucket holding the given fraction (0..1) of samples
+        sf::Time percentile(float fraction) const;
+
+        std::size_t getSampleCount() const noexcept { return m_count; }
+        sf::Time getMax() const noexcept { return m_max; }
+
+    private:
+        std::array<std::uint32_t, Constants::FRAME_HISTOGRAM_BUCKETS> m_buckets{};
+        std::size_t m_count{ 0 };
+        sf::Time m_max{ sf::Time::Zero };
+    };
+}
@@ -1,16 +1,34 @@
 #pragma once
 
+#include "DebugOverlay.h"
+#include "DrawList.h"
+#include "FramePacer.h"
+#include "FrameTimeHistogram.h"
+#include "GlyphWarmer.h"
+#include "InputSnapshot.h"
 #include "MusicPlayer.h"
 #include "StateManager.h"
 #include "Player.h"
+#include "Utils/SpscQueue.h"
+#include "Utils/TripleBuffer.h"
+#include <atomic>
+#include <deque>
+#include <exception>
+#include <optional>
+#include <thread>
 
 namespace FishGame
 {
+    // The main thread owns the window: it polls events into a lock-free
+    // queue and presents render snapshots. The simulation thread owns the
+    // states: it drains the queue, runs the fixed ticks and records each
+    // frame's drawing into a snapshot, handed over through a triple-buffered
+    // mailbox. Drawing one frame overlaps simulating the next.
     class Game
     {
     public:
-        Game();
-        ~Game() = default;
+        explicit Game(unsigned int tickRate = Constants::DEFAULT_TICK_RATE);
+        ~Game();
 
         // Delete copy and move operations - Game is a singleton-like manager
         Game(const Game&) = delete;
@@ -20,9 +38,12 @@ namespace FishGame
 
         void run();
 
+        // States run on the simulation thread and never touch the window;
+        // it is not resizable, so its size is fixed
+        sf::Vector2u getWindowSize() const noexcept { return { m_windowWidth, m_windowHeight }; }
+        void setMouseCursorVisible(bool visible) noexcept { m_cursorVisible = visible; }
+
         // Resource accessors
-        sf::RenderWindow& getWindow() { return m_window; }
-        const sf::RenderWindow& getWindow() const { return m_window; }
         FontHolder& getFonts() { return m_fonts; }
         SpriteManager& getSpriteManager() { return *m_spriteManager; }
         MusicPlayer& getMusicPlayer() { return *m_musicPlayer; }
@@ -30,6 +51,47 @@ namespace FishGame
         SoundPlayer& getSoundPlayer() { return *m_soundPlayer; }
         const SoundPlayer& getSoundPlayer() const { return *m_soundPlayer; }
 
+        // Simulation tick rate in Hz, clamped to the supported range; takes
+        // effect from the next frame. Call before run() or from a state.
+        void setTickRate(unsigned int tickRate);
+        unsigned int getTickRate() const noexcept { return m_tickRate; }
+        sf::Time getTimePerTick() const noexcept { return m_timePerFrame; }
+
+        // Limiter paces frames itself, VSync leaves it to the driver; call
+        // before run()
+        void setPacingMode(PacingMode mode);
+        PacingMode getPacingMode() const noexcept { return m_pacer.getMode(); }
+
+        // When enabled, a simulation that keeps hitting the catch-up cap runs
+        // in slow motion instead of dropping time every frame; call before run()
+        void setTimeDilation(bool enabled) noexcept { m_timeDilation = enabled; }
+        bool isTimeDilationEnabled() const noexcept { return m_timeDilation; }
+
+        // Real time the loop could not simulate, accumulated since launch
+        struct SimulationStats
+        {
+            sf::Time droppedTime = sf::Time::Zero;   // discarded by clamping or the tick cap
+            sf::Time dilatedTime = sf::Time::Zero;   // absorbed by time dilation
+            std::size_t clampedFrames = 0;           // frames longer than MAX_FRAME_TIME
+            std::size_t cappedFrames = 0;            // frames that hit MAX_CATCH_UP_TIME
+            float timeScale = 1.0f;
+        };
+
+        // Input for the ticks currently running; read-only during update()
+        const InputSnapshot& getInputSnapshot() const noexcept { return m_inputSnapshot; }
+
+        // Time from polling an input event to presenting the first frame
+        // simulated with it
+        struct InputLatency
+        {
+            sf::Time last = sf::Time::Zero;
+            sf::Time average = sf::Time::Zero;
+        };
+
+        // Fraction of a tick elapsed since the last update, for rendering
+        // between the previous and current simulation states
+        float getInterpolationAlpha() const noexcept { return m_interpolationAlpha; }
+
         // State management
         void pushState(StateID id);
         void popState();
@@ -46,10 +108,30 @@ namespace FishGame
         }
 
     private:
-        // Core game loop methods
+        // What the simulation hands the main thread for one frame
+        struct RenderSnapshot
+        {
+            DrawList drawList;
+            SimulationStats stats;
+            unsigned int tickRate = 0;
+            std::size_t lazyGlyphLoads = 0;
+            // Oldest input first simulated for this frame, if any was
+            std::optional<InputLatch::Clock::time_point> latchedInput;
+        };
+
+        // Main thread
         void processInput();
-        void update(sf::Time deltaTime);
         void render();
+        void recordFrameTime(sf::Time frameTime);
+        void recordInputLatency(InputLatch::Clock::time_point polledAt);
+        void stopSimulation() noexcept;
+
+        // Simulation thread
+        void simulate();
+        void drainInput();
+        void update(sf::Time deltaTime);
+        void adaptTimeScale(bool behind);
+        void recordFrame(std::optional<InputLatch::Clock::time_point> latchedInput);
 
         // Initialize graphics system
         void initializeGraphics();
@@ -68,10 +150,18 @@ namespace FishGame
         static constexpr unsigned int m_windowWidth = Constants::WINDOW_WIDTH;
         static constexpr unsigned int m_windowHeight = Constants::WINDOW_HEIGHT;
         static constexpr unsigned int m_frameRateLimit = Constants::FRAMERATE_LIMIT;
-        static const sf::Time m_timePerFrame;
 
-        // Core systems
+        // Simulation thread once run() starts
+        unsigned int m_tickRate{ Constants::DEFAULT_TICK_RATE };
+        sf::Time m_timePerFrame{ sf::seconds(1.0f / Constants::DEFAULT_TICK_RATE) };
+        unsigned int m_maxCatchUpTicks{ 1 };
+        float m_interpolationAlpha{ 1.f };
+        bool m_timeDilation{ false };
+        SimulationStats m_simulationStats;
+
+        // Core systems; the window is main-thread only
         sf::RenderWindow m_window;
+        bool m_cursorShown{ true };
         FontHolder m_fonts;
         std::unique_ptr<ResourceHolder<sf::Texture, TextureID>> m_spriteTextures;
 
@@ -88,6 +178,26 @@ namespace FishGame
             sf::Time accumulatedTime = sf::Time::Zero;
             std::size_t frameCount = 0;
             float currentFPS = 0.0f;
+            sf::Time reportTime = sf::Time::Zero;
         } m_metrics;
+
+        FramePacer m_pacer{ m_frameRateLimit };
+        FrameTimeHistogram m_frameTimes;
+        std::unique_ptr<DebugOverlay> m_debugOverlay;
+        std::unique_ptr<GlyphWarmer> m_glyphWarmer;
+
+        InputLatch m_inputLatch;
+        InputSnapshot m_inputSnapshot;
+        InputLatency m_inputLatency;
+        std::deque<PolledEvent> m_unsentEvents;   // overflow of m_events, main thread only
+
+        // Shared between the threads
+        SpscQueue<PolledEvent, Constants::INPUT_QUEUE_CAPACITY> m_events;
+        TripleBuffer<RenderSnapshot> m_frames;
+        std::atomic<bool> m_cursorVisible{ true };
+        std::atomic<bool> m_stopSimulation{ false };
+        std::atomic<bool> m_simulationDone{ false };
+        std::exception_ptr m_simulationError;   // read after the join only
+        std::thread m_simulation;
     };
 }
@@ -1,6 +1,8 @@
 #pragma once
 
 #include <SFML/Graphics.hpp>
+#include <array>
+#include <utility>
 
 namespace FishGame
 {
@@ -11,10 +13,38 @@ namespace FishGame
         constexpr unsigned int WINDOW_HEIGHT = 1080;
         constexpr unsigned int FRAMERATE_LIMIT = 60;
 
+        // Simulation tick rate (Hz); the fixed timestep is its reciprocal and
+        // may be chosen at launch (--tick-rate) or from the options screen
+        constexpr unsigned int DEFAULT_TICK_RATE = 60;
+        constexpr std::array<unsigned int, 4> TICK_RATE_OPTIONS{ 30, 60, 120, 240 };
+        constexpr unsigned int MIN_TICK_RATE = TICK_RATE_OPTIONS.front();
+        constexpr unsigned int MAX_TICK_RATE = TICK_RATE_OPTIONS.back();
+
+        // Catch-up limits for the fixed-step loop: frames longer than
+        // MAX_FRAME_TIME are clamped, at most MAX_CATCH_UP_TIME of simulated
+        // time runs per frame (rounded to whole ticks at the current rate),
+        // and optional time dilation slows the game to no less than
+        // MIN_TIME_SCALE of real time while the simulation is behind
+        constexpr float MAX_FRAME_TIME = 0.25f;
+        constexpr float MAX_CATCH_UP_TIME = 5.0f / 60.0f;
+        constexpr float MIN_TIME_SCALE = 0.5f;
+
+        // Frame pacing: the limiter sleeps until this close to the deadline
+        // and spins the rest, since OS sleeps overshoot by a millisecond or more
+        constexpr float FRAME_PACER_SPIN_MS = 2.0f;
+        // Frame-time histogram resolution and range (longer frames share the last bucket)
+        constexpr float FRAME_HISTOGRAM_BUCKET_MS = 0.1f;
+        constexpr std::size_t FRAME_HISTOGRAM_BUCKETS = 500;
+        // Window events in flight from the main thread to the simulation;
+        // the simulation drains them every frame, so this only fills on a stall
+        constexpr std::size_t INPUT_QUEUE_CAPACITY = 256;
+
         // Derived window values
         constexpr float WINDOW_CENTER_X = WINDOW_WIDTH / 2.0f;
         constexpr float WINDOW_CENTER_Y = WINDOW_HEIGHT / 2.0f;
         constexpr float CAMERA_ZOOM_FACTOR = 0.6f;
+        // Exponential follow rate (1/s): ~10% of the gap closed per 60 Hz tick
+        constexpr float CAMERA_FOLLOW_RATE = 6.32f;
 
         // ==================== Mathematical Constants ====================
         constexpr float PI = 3.14159265359f;
@@ -25,6 +55,8 @@ namespace FishGame
         constexpr float PLAYER_BASE_SPEED = 400.0f;
         constexpr float PLAYER_ACCELERATION = 10.0f;
         constexpr float PLAYER_DECELERATION = 8.0f;
+        // Exponential drag (1/s) while coasting: ~0.9 retained per 60 Hz tick
+        constexpr float PLAYER_COAST_DRAG = 6.32f;
         constexpr float PLAYER_MAX_SPEED = 600.0f;
         constexpr float PLAYER_BASE_RADIUS = 20.0f;
         constexpr float PLAYER_GROWTH_FACTOR = 1.5f;
@@ -60,6 +92,14 @@ namespace FishGame
         // ==================== AI Settings ====================
         constexpr float AI_DETECTION_RANGE = 80.0f;
         constexpr float AI_FLEE_RANGE = 65.0f;
+
+        // AI level of detail: fish plan every AI_PLAN_INTERVAL within the
+        // first distance of the player or camera, then every 2nd/4th/8th
+        // interval further out
+        constexpr float AI_LOD_DISTANCES[] = { 400.0f, 800.0f, 1200.0f };
+        constexpr float AI_PLAN_INTERVAL = 1.0f / 60.0f;
+        constexpr float AI_TICK_BUDGET_MS = 1.0f;
+        constexpr std::size_t AI_PLAN_CHUNK = 32;
         constexpr float SPAWN_MARGIN = 50.0f;
         constexpr float SAFE_SPAWN_PADDING = SPAWN_MARGIN * 2.0f;
 
@@ -83,6 +123,14 @@ namespace FishGame
         constexpr float FPS_TEXT_X_OFFSET = 100.0f;
         constexpr float HUD_EFFECTS_TEXT_X = 50.0f;
         constexpr float HUD_EFFECTS_TEXT_Y_OFFSET = 100.0f;
+        constexpr unsigned int DEBUG_OVERLAY_FONT_SIZE = 18;
+
+        // Text styles rasterized at startup so their first appearance in play
+        // does not stall on glyph loading: plain sizes, then (size, outline)
+        constexpr std::array<unsigned int, 9> WARMED_FONT_SIZES{ 16, 18, 20, 24, 28, 30, 32, 36, 48 };
+        constexpr std::array<std::pair<unsigned int, float>, 5> WARMED_OUTLINED_FONT_SIZES{ {
+            { 24, 1.0f }, { 28, 1.5f }, { 32, 2.0f }, { 36, 2.0f }, { 48, 2.0f }
+        } };
 
         // ==================== System UI Positions ====================
         constexpr float FRENZY_Y_POSITION = 100.0f;
@@ -103,6 +151,7 @@ namespace FishGame
 
         // ==================== Timing ====================
         const sf::Time FPS_UPDATE_INTERVAL = sf::seconds(1.0f);
+        const sf::Time FRAME_REPORT_INTERVAL = sf::seconds(2.0f);
         const sf::Time SCHOOL_EXTRACT_INTERVAL = sf::seconds(0.1f);
         const sf::Time WIN_SEQUENCE_DURATION = sf::seconds(5.0f);
         const sf::Time RESPAWN_DELAY = sf::seconds(1.5f);
@@ -121,6 +170,30 @@ namespace FishGame
         constexpr int MAX_ENTITIES = 100;
         constexpr int MAX_BONUS_ITEMS = 20;
         constexpr int MAX_PARTICLES = 200;
+        // Floating score slots; the oldest label is recycled when all are live
+        constexpr std::size_t MAX_FLOATING_SCORES = 32;
+
+        // Render culling: extra world units kept around the view so sprites
+        // larger than their collision bounds never pop at the edges
+        constexpr float RENDER_CULL_MARGIN = 256.0f;
+
+        // Animation LOD: visible entities beyond this distance from the view
+        // centre animate at a reduced rate; hidden ones defer their frames
+        constexpr float ANIMATION_LOD_NEAR_DISTANCE = 450.0f;
+        constexpr float ANIMATION_LOD_REDUCED_STEP = 1.0f / 20.0f;
+        constexpr float ANIMATION_LOD_MAX_CATCH_UP = 1.0f;
+
+        // ==================== Collision Broad-Phase ====================
+        constexpr float COLLISION_CELL_SIZE = 128.0f;
+        // Entities moving further than this fraction of their radius per tick get swept tests
+        constexpr float SWEEP_RADIUS_FRACTION = 0.5f;
+        // Larger jumps are teleports (respawns, wrap-arounds) and are not swept
+        constexpr float SWEEP_MAX_DISTANCE = 200.0f;
+        // Jellyfish stun length; lasting contacts re-apply it once per stun period
+        constexpr float JELLYFISH_STUN_DURATION = 1.0f;
+        constexpr float JELLYFISH_CONTACT_REPEAT = JELLYFISH_STUN_DURATION;
+        // An inflated pufferfish bounces the player at most once per window
+        constexpr float PUFFERFISH_BOUNCE_COOLDOWN = 0.5f;
 
         // ==================== Difficulty ====================
         constexpr float DIFFICULTY_INCREMENT = 0.1f;
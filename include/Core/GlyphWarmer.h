@@ -0,0 +1,48 @@
+#pragma once
+
+#include <SFML/Graphics.hpp>
+#include <cstddef>
+#include <vector>
+
+namespace FishGame
+{
+    // sf::Font rasterizes each (character, size, outline) the first time it
+    // is drawn, which stalls the frame it happens in. This loads the
+    // printable ASCII set for every registered style up front and then
+    // watches the font pages for loads it did not anticipate.
+    class GlyphWarmer
+    {
+    public:
+        explicit GlyphWarmer(const sf::Font& font);
+
+        void registerStyle(unsigned int characterSize, float outlineThickness = 0.0f);
+
+        // Rasterizes every registered style; needs the window's context active
+        void warm();
+
+        // Returns how many warmed pages grew since the last poll. A page
+        // only grows when a glyph needs new atlas space, so this undercounts
+        // loads that fit into existing rows.
+        std::size_t poll();
+
+        std::size_t getLazyLoads() const noexcept { return m_lazyLoads; }
+
+    private:
+        struct Style
+        {
+            unsigned int characterSize;
+            float outlineThickness;
+        };
+
+        struct Page
+        {
+            unsigned int characterSize;
+            sf::Vector2u textureSize;
+        };
+
+        const sf::Font& m_font;
+        std::vector<Style> m_styles;
+        std::vector<Page> m_pages;
+        std::size_t m_lazyLoads{ 0 };
+    };
+}
@@ -0,0 +1,68 @@
+#pragma once
+
+#include <SFML/Graphics.hpp>
+#include <chrono>
+#include <cstdint>
+#include <optional>
+
+namespace FishGame
+{
+    using InputMask = std::uint8_t;
+
+    namespace InputButton
+    {
+        constexpr InputMask None = 0;
+        constexpr InputMask Up = 1u << 0;
+        constexpr InputMask Down = 1u << 1;
+        constexpr InputMask Left = 1u << 2;
+        constexpr InputMask Right = 1u << 3;
+
+        constexpr InputMask Movement = Up | Down | Left | Right;
+    }
+
+    // Input as the simulation sees it for one batch of ticks. Built just
+    // before the ticks start and read-only while they run.
+    struct InputSnapshot
+    {
+        InputMask held{ InputButton::None };
+        sf::Vector2i mousePosition{};   // window coordinates
+        std::uint64_t sequence{ 0 };
+
+        bool isHeld(InputMask buttons) const noexcept { return (held & buttons) != 0; }
+    };
+
+    // A window event as the main thread polled it, on its way to the
+    // simulation thread
+    struct PolledEvent
+    {
+        sf::Event event;
+        std::chrono::steady_clock::time_point polledAt;
+        std::uint8_t boundKeys{ 0 };    // from InputLatch::queryKeys(); GainedFocus only
+    };
+
+    // Tracks key and mouse state from window events so building a snapshot
+    // costs no device queries. The keyboard is only queried after the
+    // window regains focus, to pick up keys that changed while it was away;
+    // the main thread does that query and sends the result with the event.
+    class InputLatch
+    {
+    public:
+        using Clock = std::chrono::steady_clock;
+
+        // Bound keys held right now, one bit each; main thread only
+        static std::uint8_t queryKeys();
+
+        void handleEvent(const PolledEvent& polled);
+        void resync(std::uint8_t keys) noexcept { m_keys = keys; }
+
+        // Publishes the current state and returns when the oldest input
+        // event it contains was polled, if it contains any
+        std::optional<Clock::time_point> latch(InputSnapshot& snapshot);
+
+    private:
+        std::uint8_t m_keys{ 0 };       // one bit per bound key
+        sf::Vector2i m_mousePosition{};
+        std::uint64_t m_sequence{ 0 };
+        std::optional<Clock::time_point> m_pendingSince;
+    };
+}
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <SFML/Graphics.hpp>
+#include "DrawList.h"
 #include <memory>
 #include <functional>
 #include <type_traits>
@@ -38,7 +39,8 @@ namespace FishGame
     template<typename T>
     struct is_state : std::false_type {};
 
-    // Abstract base class for game states
+    // Abstract base class for game states. States live on the simulation
+    // thread: they handle events, update and record their drawing there.
     class State
     {
     public:
@@ -59,7 +61,7 @@ namespace FishGame
         // Pure virtual functions
         virtual void handleEvent(const sf::Event& event) = 0;
         virtual bool update(sf::Time deltaTime) = 0;
-        virtual void render() = 0;
+        virtual void render(DrawList& target) = 0;
 
         // Optional virtual functions
         virtual void onActivate() {}
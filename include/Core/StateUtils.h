@@ -4,6 +4,9 @@
 #include <optional>
 #include <functional>
 #include "CollisionDetector.h"
+#include "SpriteBatch.h"
+#include "DrawHelpers.h"
+#include "GameConstants.h"
 
 namespace FishGame::StateUtils
 {
@@ -53,18 +56,76 @@ namespace FishGame::StateUtils
             container.end());
     }
 
-    // Render all alive entities
+    // Area of the target's current view worth drawing into
+    inline sf::FloatRect cullArea(const DrawList& target)
+    {
+        return DrawUtils::visibleArea(target.getView(), Constants::RENDER_CULL_MARGIN);
+    }
+
+    // Pick each entity's animation LOD from the camera: hidden outside the
+    // render cull area, reduced when far from the view centre
     template<typename Container>
-    void renderContainer(const Container& container, sf::RenderWindow& window)
+    void assignAnimationDetail(Container& container, const sf::View& view)
     {
+        const sf::FloatRect area = DrawUtils::visibleArea(view, Constants::RENDER_CULL_MARGIN);
+        const sf::Vector2f focus = view.getCenter();
+        constexpr float nearSq = Constants::ANIMATION_LOD_NEAR_DISTANCE * Constants::ANIMATION_LOD_NEAR_DISTANCE;
+
         std::for_each(container.begin(), container.end(),
-            [&window](const auto& entity)
+            [&area, focus](auto& entity)
             {
-                if (entity && entity->isAlive())
+                if (!entity || !entity->isAlive())
+                    return;
+
+                const sf::Vector2f offset = entity->getPosition() - focus;
+                AnimationDetail detail = AnimationDetail::Full;
+                if (!entity->getBounds().intersects(area))
+                    detail = AnimationDetail::Hidden;
+                else if (offset.x * offset.x + offset.y * offset.y > nearSq)
+                    detail = AnimationDetail::Reduced;
+                entity->setAnimationDetail(detail);
+            });
+    }
+
+    // Render all alive entities inside the target's view
+    template<typename Container>
+    void renderContainer(const Container& container, DrawList& target)
+    {
+        const sf::FloatRect area = cullArea(target);
+        std::for_each(container.begin(), container.end(),
+            [&target, &area](const auto& entity)
+            {
+                if (entity && entity->isAlive() && entity->getBounds().intersects(area))
+                {
+                    target.draw(*entity);
+                }
+            });
+    }
+
+    // Render alive entities through a sprite batch: quads sharing a texture
+    // become one draw call, anything that cannot batch is drawn after them.
+    // Entities outside the target's view are skipped. Each entity is drawn
+    // at its position interpolated by alpha between the last two ticks.
+    template<typename Container>
+    void renderBatched(const Container& container, DrawList& target, SpriteBatch& batch,
+                       float alpha = 1.f)
+    {
+        const sf::FloatRect area = cullArea(target);
+        batch.clear();
+        std::for_each(container.begin(), container.end(),
+            [&batch, &area, alpha](const auto& entity)
+            {
+                if (!entity || !entity->isAlive() || !entity->getBounds().intersects(area))
+                    return;
+
+                batch.setOffset(entity->getInterpolatedPosition(alpha) - entity->getPosition());
+
+                if (!entity->appendToBatch(batch))
                 {
-                    window.draw(*entity);
+                    batch.defer(*entity);
                 }
             });
+        batch.draw(target);
     }
 
     // Generic collision detection between two containers
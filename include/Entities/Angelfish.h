@@ -3,6 +3,7 @@
 #include "AdvancedFish.h"
 #include "SpriteManager.h"
 #include <SFML/Graphics/CircleShape.hpp>
+#include <random>
 
 namespace FishGame {
 
@@ -19,19 +20,22 @@ public:
 
     void update(sf::Time deltaTime) override;
 
-    void updateAI(const std::vector<std::unique_ptr<Entity>>& entities,
-                  const Entity* player, sf::Time deltaTime) override;
+    void planAI(const AISnapshot& world, const AIEntityState& self,
+                sf::Time deltaTime) override;
+    void applyAI() override;
 
     void onCollide(Player& player, CollisionSystem& system) override;
 
+    // Fins are drawn beneath the sprite
+    bool appendToBatch(SpriteBatch& /*batch*/) const override { return false; }
+
 protected:
-    void draw(sf::RenderTarget& target, sf::RenderStates states) const override;
+    void draw(DrawList& target, sf::RenderStates states) const override;
 
 private:
     void updateErraticMovement(sf::Time deltaTime);
-    void updateEvasiveMovement(const std::vector<std::unique_ptr<Entity>>& entities,
-                               const Entity* player);
-    sf::Vector2f calculateEscapeVector(const std::vector<const Entity*>& threats);
+    void addEscapeContribution(const AIEntityState& self, const AIEntityState& threat);
+    sf::Vector2f resolveEscapeVector();
 
 private:
     int m_bonusPoints;
@@ -43,6 +47,19 @@ private:
     bool m_isEvading;
     sf::Time m_evasionTimer;
 
+    // Pending evasion state written by planAI; noise is added in applyAI
+    struct EvasionPlan
+    {
+        bool active = false;
+        bool hasThreats = false;
+        bool isEvading = false;
+        sf::Time evasionTimer{ sf::Time::Zero };
+        const Entity* threat = nullptr;
+        sf::Vector2f escape{};
+    };
+    EvasionPlan m_evasionPlan;
+    std::mt19937 m_aiRng;
+
     static constexpr float m_baseSpeed = 280.0f;
     static constexpr float m_evadeSpeed = 400.0f;
     static constexpr float m_directionChangeInterval = 0.3f;
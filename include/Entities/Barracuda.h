@@ -17,17 +17,19 @@ public:
     TextureID getTextureID() const override { return TextureID::Barracuda; }
     int getScorePoints() const override { return Constants::BARRACUDA_POINTS; }
 
-    void updateAI(const std::vector<std::unique_ptr<Entity>>& entities,
-                  const Entity* player, sf::Time deltaTime);
+    void planAI(const AISnapshot& world, const AIEntityState& self,
+                sf::Time deltaTime) override;
+    void applyAI() override;
 
     void update(sf::Time deltaTime) override;
     void initializeSprite(SpriteManager& spriteManager);
     void playEatAnimation() override;
+    bool appendToBatch(SpriteBatch& batch) const override;
 protected:
-    void draw(sf::RenderTarget& target, sf::RenderStates states) const override;
+    void draw(DrawList& target, sf::RenderStates states) const override;
 
 private:
-    void updateHuntingBehavior(const Entity* target, sf::Time /*deltaTime*/);
+    void planHunt(const AIEntityState& self, const AIEntityState& target);
 
 private:
     const Entity* m_currentTarget;
@@ -35,6 +37,18 @@ private:
     float m_dashSpeed;
     bool m_isDashing;
 
+    // Pending hunt state written by planAI
+    struct HuntPlan
+    {
+        bool active = false;
+        bool steer = false;
+        const Entity* target = nullptr;
+        sf::Time huntTimer{ sf::Time::Zero };
+        bool isDashing = false;
+        sf::Vector2f velocity{};
+    };
+    HuntPlan m_huntPlan;
+
     std::unique_ptr<Animator> m_animator;
     std::string m_currentAnimation;
     bool m_facingRight{ false };
@@ -39,6 +39,10 @@ namespace FishGame
         bool updateLifetime(sf::Time deltaTime);
         float computeBobbingOffset(float freqMul = 1.0f, float ampMul = 1.0f) const;
 
+        // Bonus items only bob vertically around their spawn point
+        sf::Vector2f getRestPosition() const { return sf::Vector2f(m_position.x, m_baseY); }
+        float getBobReach() const { return m_bobAmplitude < 0.f ? -m_bobAmplitude : m_bobAmplitude; }
+
     protected:
         BonusType m_bonusType;
         int m_points;
@@ -67,9 +71,10 @@ namespace FishGame
 
         void update(sf::Time deltaTime) override;
         void onCollect() override;
+        bool appendToBatch(SpriteBatch& batch) const override;
 
     protected:
-        void draw(sf::RenderTarget& target, sf::RenderStates states) const override;
+        void draw(DrawList& target, sf::RenderStates states) const override;
 
     private:
         sf::CircleShape m_shape;
@@ -3,7 +3,10 @@
 #include <SFML/Graphics.hpp>
 #include <cmath>
 #include <memory>
+#include <cstdint>
+#include <cstddef>
 #include "ICollidable.h"
+#include "DrawList.h"
 
 namespace FishGame
 {
@@ -11,6 +14,7 @@ namespace FishGame
     template<typename T> class SpriteComponent;
     enum class TextureID;
     class SpriteManager;
+    class SpriteBatch;
 
     // Entity types for identification
     enum class EntityType
@@ -24,8 +28,78 @@ namespace FishGame
         Hazard
     };
 
+    // Fish size categories for gameplay mechanics
+    enum class FishSize
+    {
+        Small,
+        Medium,
+        Large
+    };
+
+    // Compact concrete-type tag; indexes the collision dispatch table so
+    // hot paths never need RTTI. Set once by the most-derived constructor.
+    enum class EntityKind : std::uint8_t
+    {
+        Generic,
+        Player,
+        Fish,
+        Pufferfish,
+        PoisonFish,
+        Bomb,
+        Jellyfish,
+        Bonus,
+        Oyster,
+        Count
+    };
+
+    constexpr bool isFishKind(EntityKind kind) noexcept
+    {
+        return kind == EntityKind::Fish || kind == EntityKind::Pufferfish ||
+               kind == EntityKind::PoisonFish;
+    }
+
+    // How much animation work an entity does this tick
+    enum class AnimationDetail : std::uint8_t
+    {
+        Full,       // every tick
+        Reduced,    // at ANIMATION_LOD_REDUCED_STEP intervals
+        Hidden      // deferred until visible again
+    };
+
+    // Collision layer bits; a CollisionFilter decides which layers may touch
+    using LayerMask = std::uint16_t;
+
+    namespace CollisionLayer
+    {
+        constexpr LayerMask None = 0;
+        constexpr LayerMask Player = 1u << 0;
+        constexpr LayerMask SmallFish = 1u << 1;
+        constexpr LayerMask MediumFish = 1u << 2;
+        constexpr LayerMask LargeFish = 1u << 3;
+        constexpr LayerMask Hazard = 1u << 4;
+        constexpr LayerMask Bonus = 1u << 5;
+        constexpr LayerMask Oyster = 1u << 6;
+        constexpr std::size_t Count = 7;
+
+        constexpr LayerMask AnyFish = SmallFish | MediumFish | LargeFish;
+        constexpr LayerMask All = 0xFFFF;
+
+        constexpr LayerMask forSize(FishSize size) noexcept
+        {
+            switch (size)
+            {
+            case FishSize::Medium: return MediumFish;
+            case FishSize::Large: return LargeFish;
+            default: return SmallFish;
+            }
+        }
+    }
+
+    // Unique for the lifetime of the process, unlike an address
+    using EntityId = std::uint32_t;
+
     // Base class for all game entities
-    class Entity : public sf::Drawable, public ICollidable
+    class Entity : public Renderable, public ICollidable
     {
     public:
         Entity();
@@ -43,14 +117,47 @@ namespace FishGame
         virtual void update(sf::Time deltaTime) = 0;
         virtual sf::FloatRect getBounds() const = 0;
         virtual EntityType getType() const = 0;
+        EntityKind getKind() const noexcept { return m_kind; }
+        EntityId getId() const noexcept { return m_id; }
+
+        // Cached predation traits, kept current by the owning class
+        FishSize getSizeClass() const noexcept { return m_sizeClass; }
+        bool isInflated() const noexcept { return m_isInflated; }
+
+        // Collision layer this entity lives on and the layers it accepts
+        LayerMask getCollisionCategory() const noexcept { return m_collisionCategory; }
+        LayerMask getCollisionMask() const noexcept { return m_collisionMask; }
+        void setCollisionMask(LayerMask mask) noexcept { m_collisionMask = mask; }
         // Collision callback
         void onCollide(Player&, CollisionSystem&) override {}
 
         // Position management
-        void setPosition(float x, float y) noexcept { m_position = { x, y }; }
-        void setPosition(const sf::Vector2f& position) noexcept { m_position = position; }
+        // setPosition is a teleport: it also restarts the collision sweep and
+        // the render interpolation so the entity is not smeared across the jump
+        void setPosition(float x, float y) noexcept { setPosition(sf::Vector2f(x, y)); }
+        void setPosition(const sf::Vector2f& position) noexcept
+        {
+            m_position = position;
+            m_sweepStart = position;
+            m_previousPosition = position;
+        }
         const sf::Vector2f& getPosition() const noexcept { return m_position; }
 
+        // Where the last collision pass saw this entity; movement since then is swept
+        const sf::Vector2f& getSweepStart() const noexcept { return m_sweepStart; }
+        sf::Vector2f getSweepDelta() const noexcept { return m_position - m_sweepStart; }
+        void resetSweep() noexcept { m_sweepStart = m_position; }
+
+        // Render interpolation: call storePreviousPosition() before each tick,
+        // then draw at getInterpolatedPosition(alpha) with alpha in [0, 1]
+        void storePreviousPosition() noexcept { m_previousPosition = m_position; m_hasPreviousPosition = true; }
+        sf::Vector2f getInterpolatedPosition(float alpha) const noexcept
+        {
+            if (!m_hasPreviousPosition)
+                return m_position;
+            return m_previousPosition + (m_position - m_previousPosition) * alpha;
+        }
+
         // Velocity management
         void setVelocity(float vx, float vy) noexcept { m_velocity = { vx, vy }; }
         void setVelocity(const sf::Vector2f& velocity) noexcept { m_velocity = velocity; }
@@ -75,27 +182,54 @@ namespace FishGame
         // Helper to create a default sprite for this entity
         void setupSprite(SpriteManager& spriteManager, TextureID textureId);
 
+        // Adds this entity's quads to a batch instead of drawing them; entities
+        // drawn with shapes or extra layers return false and draw normally
+        virtual bool appendToBatch(SpriteBatch& /*batch*/) const { return false; }
+
         // Visual mode
         enum class RenderMode { Circle, Sprite };
         void setRenderMode(RenderMode mode) { m_renderMode = mode; }
         RenderMode getRenderMode() const { return m_renderMode; }
 
+        // Animation LOD, assigned by the owning state from the camera
+        void setAnimationDetail(AnimationDetail detail) noexcept { m_animationDetail = detail; }
+        AnimationDetail getAnimationDetail() const noexcept { return m_animationDetail; }
+
     protected:
         // Protected draw function for derived classes
-        void draw(sf::RenderTarget& target, sf::RenderStates states) const override = 0;
+        void draw(DrawList& target, sf::RenderStates states) const override = 0;
 
         // Common update pattern for derived classes
         void updateMovement(sf::Time deltaTime) noexcept { updatePosition(deltaTime); }
 
+        // Banks deltaTime and returns the time visuals should advance by this
+        // tick: everything banked, or zero while the LOD defers the step.
+        // Call once per update; getAnimationStep() repeats the result.
+        sf::Time advanceAnimationClock(sf::Time deltaTime) noexcept;
+        sf::Time getAnimationStep() const noexcept { return m_animationStep; }
+
     protected:
+        EntityId m_id;
         sf::Vector2f m_position{ 0.0f, 0.0f };
+        sf::Vector2f m_sweepStart{ 0.0f, 0.0f };
+        sf::Vector2f m_previousPosition{ 0.0f, 0.0f };
+        bool m_hasPreviousPosition{ false };
         sf::Vector2f m_velocity{ 0.0f, 0.0f };
         float m_radius{ 0.0f };
         bool m_isAlive{ true };
+        EntityKind m_kind{ EntityKind::Generic };
+        FishSize m_sizeClass{ FishSize::Small };
+        bool m_isInflated{ false };
+        LayerMask m_collisionCategory{ CollisionLayer::None };
+        LayerMask m_collisionMask{ CollisionLayer::All };
 
         // Sprite component - using unique_ptr requires complete type in .cpp
         std::unique_ptr<SpriteComponent<Entity>> m_sprite;
         RenderMode m_renderMode = RenderMode::Sprite;
+
+        AnimationDetail m_animationDetail{ AnimationDetail::Full };
+        sf::Time m_animationBank{ sf::Time::Zero };
+        sf::Time m_animationStep{ sf::Time::Zero };
     };
 
     // Utility functions for entity operations
@@ -137,6 +271,39 @@ namespace FishGame
             return distanceSquared(a, b) < (radiusSum * radiusSum);
         }
 
+        // Earliest t in [0, 1] at which two circles moving linearly from
+        // startA/startB by deltaA/deltaB overlap, or -1 if they never do
+        inline float timeOfImpact(const sf::Vector2f& startA, const sf::Vector2f& deltaA,
+                                  const sf::Vector2f& startB, const sf::Vector2f& deltaB,
+                                  float radiusSum) noexcept
+        {
+            const sf::Vector2f start = startA - startB;
+            const sf::Vector2f motion = deltaA - deltaB;
+
+            const float c = start.x * start.x + start.y * start.y - radiusSum * radiusSum;
+            if (c < 0.0f)
+                return 0.0f;
+
+            const float a = motion.x * motion.x + motion.y * motion.y;
+            const float b = start.x * motion.x + start.y * motion.y;
+            if (a <= 0.0f || b >= 0.0f)
+                return -1.0f;   // not moving or moving apart
+
+            const float discriminant = b * b - a * c;
+            if (discriminant <= 0.0f)
+                return -1.0f;   // closest approach only grazes
+
+            const float t = (-b - std::sqrt(discriminant)) / a;
+            return t <= 1.0f ? t : -1.0f;
+        }
+
+        // Overlap depth of two circles; positive while they intersect
+        template<CircularEntity A, CircularEntity B>
+        inline float penetration(const A& a, const B& b) noexcept
+        {
+            return a.getRadius() + b.getRadius() - distance(a, b);
+        }
+
         // Apply a function to all alive entities in a container
         template<typename Container, typename Func>
         void forEachAlive(Container& entities, Func&& func)
@@ -21,7 +21,7 @@ namespace FishGame
         void setFont(const sf::Font& font) { m_icon.setFont(font); }
 
     protected:
-        void draw(sf::RenderTarget& target, sf::RenderStates states) const override;
+        void draw(DrawList& target, sf::RenderStates states) const override;
 
     private:
         sf::Text m_icon;
@@ -44,7 +44,7 @@ namespace FishGame
         void initializeSprite(SpriteManager& spriteManager);
 
     protected:
-        void draw(sf::RenderTarget& target, sf::RenderStates states) const override;
+        void draw(DrawList& target, sf::RenderStates states) const override;
 
     private:
         sf::CircleShape m_heart;
@@ -67,7 +67,7 @@ namespace FishGame
         void initializeSprite(SpriteManager& spriteManager);
 
     protected:
-        void draw(sf::RenderTarget& target, sf::RenderStates states) const override;
+        void draw(DrawList& target, sf::RenderStates states) const override;
 
     private:
         std::vector<sf::ConvexShape> m_speedLines;
@@ -91,7 +91,7 @@ namespace FishGame
         void initializeSprite(SpriteManager& spriteManager);
 
     protected:
-        void draw(sf::RenderTarget& target, sf::RenderStates states) const override;
+        void draw(DrawList& target, sf::RenderStates states) const override;
 
     private:
         // No custom visuals when using sprite
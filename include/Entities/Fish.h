@@ -1,6 +1,7 @@
 #pragma once
 
 #include "Entity.h"
+#include "Predation.h"
 #include "Animator.h"
 #include "Strategy.h"
 #include "GameConstants.h"
@@ -14,21 +15,14 @@ namespace FishGame
     class SpriteManager;
     enum class TextureID;
     template<typename T> class SpriteComponent;
-
-    // Fish size categories for gameplay mechanics
-    enum class FishSize
-    {
-        Small,
-        Medium,
-        Large
-    };
+    struct AISnapshot;
+    struct AIEntityState;
 
     // Base class for all fish entities
     class Fish : public Entity
     {
         friend class CollisionSystem;
     public:
-        using ICollidable::onCollideWith;
         Fish(FishSize size, float speed, int currentLevel);
         virtual ~Fish() = default;
 
@@ -66,9 +60,13 @@ namespace FishGame
         virtual int getPointValue() const { return m_pointValue; }
         // Points awarded when this fish is eaten by the player
         virtual int getScorePoints() const;
-        virtual bool canEat(const Entity& other) const;
-        virtual void updateAI(const std::vector<std::unique_ptr<Entity>>& entities,
-            const Entity* player, sf::Time /*deltaTime*/);
+        bool canEat(const Entity& other) const { return Predation::canEat(*this, other); }
+
+        // Two-phase AI: planAI may only read the snapshot and write this
+        // fish's own plan (it runs in parallel); applyAI commits the plan.
+        virtual void planAI(const AISnapshot& world, const AIEntityState& self,
+            sf::Time deltaTime);
+        virtual void applyAI();
 
         void setDirection(float dirX, float dirY);
         void setWindowBounds(const sf::Vector2u& windowSize);
@@ -91,13 +89,11 @@ namespace FishGame
 
         // Collision interaction
         void onCollide(Player& player, CollisionSystem& system) override;
-        void onCollideWith(Entity& other, CollisionSystem& system) override;
-        void onCollideWith(Fish& fish, CollisionSystem& system) override;
-        void onCollideWith(Hazard& hazard, CollisionSystem& system) override;
-        void onCollideWith(BonusItem& item, CollisionSystem& system) override;
+
+        bool appendToBatch(SpriteBatch& batch) const override;
 
     protected:
-        void draw(sf::RenderTarget& target, sf::RenderStates states) const override;
+        void draw(DrawList& target, sf::RenderStates states) const override;
         void updateMovement(sf::Time deltaTime);
 
         // Sprite-specific updates
@@ -147,5 +143,13 @@ namespace FishGame
         static constexpr float m_eatDuration = 0.5f;
 
         std::unique_ptr<MovementStrategy> m_movementStrategy;
+
+        // Result of the last planAI call, consumed by applyAI
+        struct AIPlan
+        {
+            bool steer = false;
+            sf::Vector2f direction{};
+        };
+        AIPlan m_aiPlan;
     };
 }
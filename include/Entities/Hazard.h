@@ -1,6 +1,7 @@
 #pragma once
 
 #include "Entity.h"
+#include "GameConstants.h"
 #include <vector>
 #include <random>
 #include <memory>
@@ -20,7 +21,6 @@ namespace FishGame
     {
         friend class CollisionSystem;
     public:
-        using ICollidable::onCollideWith;
         Hazard(HazardType type, float damageAmount);
         virtual ~Hazard() = default;
 
@@ -30,8 +30,6 @@ namespace FishGame
 
         virtual void onContact(Entity& entity) = 0;
         void onCollide(Player& player, CollisionSystem& system) override = 0;
-        void onCollideWith(Entity& other, CollisionSystem& system) override;
-        void onCollideWith(Fish& fish, CollisionSystem& system) override;
 
     protected:
         HazardType m_hazardType;
@@ -60,9 +58,10 @@ namespace FishGame
         float getExplosionRadius() const { return m_explosionRadius; }
 
         void onCollide(Player& player, CollisionSystem& system) override;
+        bool appendToBatch(SpriteBatch& batch) const override;
 
     protected:
-        void draw(sf::RenderTarget& target, sf::RenderStates states) const override;
+        void draw(DrawList& target, sf::RenderStates states) const override;
 
     private:
         enum class State { IdleBomb, Explode, Puffs, Smoke, Done };
@@ -108,13 +107,13 @@ namespace FishGame
 
         sf::Time getStunDuration() const { return m_stunDuration; }
 
-        // Push collided entity slightly forward
+        // One-shot push away from the bell; callers apply it once per stun
         void pushEntity(Entity& entity) const;
 
         void onCollide(Player& player, CollisionSystem& system) override;
 
     protected:
-        void draw(sf::RenderTarget& target, sf::RenderStates states) const override;
+        void draw(DrawList& target, sf::RenderStates states) const override;
 
     private:
         sf::CircleShape m_bell;
@@ -123,7 +122,7 @@ namespace FishGame
         float m_tentacleWave;
         sf::Time m_stunDuration;
 
-        static constexpr float m_stunEffectDuration = 1.0f;
+        static constexpr float m_stunEffectDuration = Constants::JELLYFISH_STUN_DURATION;
         static constexpr int m_tentacleCount = 8;
 
         static constexpr float m_pushDistance = 15.0f;
@@ -136,6 +135,7 @@ namespace FishGame
         static constexpr float m_frameTime = 0.1f; // seconds per frame
         static constexpr int m_frameHeight = 197;
         int m_frameWidth{ 0 };
+        sf::Vector2i m_frameOrigin{ 1, 1 };
         const sf::Texture* m_texture{ nullptr };
     };
 }
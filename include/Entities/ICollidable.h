@@ -12,18 +12,7 @@ namespace FishGame {
     public:
         virtual ~ICollidable() = default;
 
+        // Player contact; pair responses live in CollisionDispatch
         virtual void onCollide(Player& player, CollisionSystem& system) = 0;
-
-        // Generic double dispatch entry point
-        virtual void onCollideWith(Entity&, CollisionSystem&) {}
-
-        // Overloads for specific entity types
-        virtual void onCollideWith(Player& player, CollisionSystem& system)
-        {
-            onCollide(player, system);
-        }
-        virtual void onCollideWith(Fish&, CollisionSystem&) {}
-        virtual void onCollideWith(Hazard&, CollisionSystem&) {}
-        virtual void onCollideWith(BonusItem&, CollisionSystem&) {}
     };
 }
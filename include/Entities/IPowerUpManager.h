@@ -1,6 +1,7 @@
 #pragma once
 
 #include <SFML/System/Time.hpp>
+#include <cstdint>
 #include <vector>
 
 namespace FishGame
@@ -19,6 +20,8 @@ namespace FishGame
         virtual sf::Time getRemainingTime(PowerUpType type) const = 0;
         virtual float getScoreMultiplier() const = 0;
         virtual std::vector<PowerUpType> getActivePowerUps() const = 0;
+        // One bit per active PowerUpType, for per-tick queries that must not allocate
+        virtual std::uint32_t getActiveMask() const = 0;
         virtual float getSpeedMultiplier() const = 0;
     };
 }
@@ -18,12 +18,12 @@ namespace FishGame
     class PlayerGrowth;
     class PlayerVisual;
     class PlayerStatus;
+    struct InputSnapshot;
 
     class Player : public Entity
     {
         friend class PlayerStatus;
     public:
-        using ICollidable::onCollideWith;
         struct VisualEffect
         {
             float scale = 1.f;
@@ -44,7 +44,7 @@ namespace FishGame
             IPowerUpManager* powerUpManager, IScoreSystem* scoreSystem);
 
         // Player-specific methods
-        void handleInput();
+        void handleInput(sf::Time deltaTime);
         sf::Vector2f getTargetPosition() const { return m_targetPosition; }
 
         // Sprite initialization
@@ -64,7 +64,9 @@ namespace FishGame
 
         // Eating mechanics
         bool canEat(const Entity& other) const;
-        bool attemptEat(Entity& other);
+        // swept: the contact was found along this tick's motion rather than
+        // at the end positions, so the mouth is tested along that motion too
+        bool attemptEat(Entity& other, bool swept = false);
         FishSize getCurrentFishSize() const;
 
         // Tail-bite detection
@@ -86,6 +88,8 @@ namespace FishGame
         void setControlsReversed(bool reversed) { m_controlsReversed = reversed; }
 
         void setSoundPlayer(SoundPlayer* player) { m_soundPlayer = player; }
+        // Movement is read from this snapshot each update; none means no input
+        void setInputSource(const InputSnapshot* source);
 
         // Size information
         bool isAtMaxSize() const { return m_currentStage >= Constants::MAX_STAGES; }
@@ -100,7 +104,11 @@ namespace FishGame
         float getSpeedMultiplier() const { return m_speedMultiplier; }
 
         int getCurrentStage() const { return m_currentStage; }
-        void setCurrentStage(int stage) { m_currentStage = stage; }
+        void setCurrentStage(int stage)
+        {
+            m_currentStage = stage;
+            m_sizeClass = getCurrentFishSize();
+        }
 
         float getGrowthProgress() const { return m_growthProgress; }
         void setGrowthProgress(float value) { m_growthProgress = value; }
@@ -150,16 +158,11 @@ namespace FishGame
         void triggerEatEffect();
         void triggerDamageEffect();
 
-        // Double dispatch handlers
-        void onCollideWith(Entity& other, CollisionSystem& system) override;
-        void onCollideWith(Fish& fish, CollisionSystem& system) override;
-        void onCollideWith(Hazard& hazard, CollisionSystem& system) override;
-
     private:
         void updateVisualEffects(sf::Time deltaTime);
 
     protected:
-        void draw(sf::RenderTarget& target, sf::RenderStates states) const override;
+        void draw(DrawList& target, sf::RenderStates states) const override;
 
     private:
         void constrainToWindow();
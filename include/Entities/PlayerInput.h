@@ -2,8 +2,7 @@
 
 #include <SFML/System/Vector2.hpp>
 #include <SFML/System/Time.hpp>
-
-namespace sf { class Keyboard; }
+#include "InputSnapshot.h"
 
 namespace FishGame
 {
@@ -13,8 +12,10 @@ namespace FishGame
     {
     public:
         explicit PlayerInput(Player& player);
-        void handleInput();
+        void handleInput(sf::Time deltaTime);
+        void setSource(const InputSnapshot* source) { m_source = source; }
     private:
         Player& m_player;
+        const InputSnapshot* m_source{ nullptr };
     };
 }
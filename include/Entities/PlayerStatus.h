@@ -15,7 +15,7 @@ namespace FishGame
         void update(sf::Time deltaTime);
 
         bool canEat(const Entity& other) const;
-        bool attemptEat(Entity& other);
+        bool attemptEat(Entity& other, bool swept = false);
         bool canTailBite(const Entity& other) const;
         bool attemptTailBite(Entity& other);
 
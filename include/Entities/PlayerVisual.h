@@ -1,6 +1,7 @@
 #pragma once
 
 #include <SFML/Graphics.hpp>
+#include "DrawList.h"
 
 namespace FishGame
 {
@@ -13,7 +14,7 @@ namespace FishGame
         void update(sf::Time deltaTime);
         void triggerEatEffect();
         void triggerDamageEffect();
-        void draw(sf::RenderTarget& target, sf::RenderStates states) const;
+        void draw(DrawList& target, sf::RenderStates states) const;
     private:
         Player& m_player;
     };
@@ -24,8 +24,11 @@ public:
 
     sf::Time getPoisonDuration() const { return m_poisonDuration; }
 
+    // Bubbles are drawn beneath the sprite
+    bool appendToBatch(SpriteBatch& /*batch*/) const override { return false; }
+
 protected:
-    void draw(sf::RenderTarget& target, sf::RenderStates states) const override;
+    void draw(DrawList& target, sf::RenderStates states) const override;
 
 private:
     void updatePoisonBubbles(sf::Time /*deltaTime*/);
@@ -62,7 +62,7 @@ namespace FishGame
         void setFont(const sf::Font& font) { m_icon.setFont(font); }
 
     protected:
-        void draw(sf::RenderTarget& target, sf::RenderStates states) const override;
+        void draw(DrawList& target, sf::RenderStates states) const override;
 
     private:
         sf::Text m_icon; // "2X" text
@@ -81,7 +81,7 @@ namespace FishGame
         void applyEffect(Player& player, CollisionSystem& system) override;
 
     protected:
-        void draw(sf::RenderTarget& target, sf::RenderStates states) const override;
+        void draw(DrawList& target, sf::RenderStates states) const override;
 
     private:
         std::vector<sf::CircleShape> m_lightningBolts;
@@ -115,6 +115,7 @@ namespace FishGame
 
         // Get all active power-ups
         std::vector<PowerUpType> getActivePowerUps() const override;
+        std::uint32_t getActiveMask() const override;
 
         // Specific power-up queries
         bool isFreezeActive() const { return isActive(PowerUpType::Freeze); }
@@ -0,0 +1,99 @@
+#pragma once
+
+#include "Entity.h"
+#include <array>
+#include <cstddef>
+
+namespace FishGame::Predation
+{
+    // Part an entity plays in the food chain
+    enum class Role : std::uint8_t
+    {
+        None,
+        Player,
+        Fish,
+        Count
+    };
+
+    constexpr std::size_t SizeCount = 3;
+    constexpr std::size_t ProfileCount = static_cast<std::size_t>(Role::Count) * SizeCount * 2;
+
+    constexpr Role roleOf(EntityKind kind) noexcept
+    {
+        if (kind == EntityKind::Player)
+            return Role::Player;
+        return isFishKind(kind) ? Role::Fish : Role::None;
+    }
+
+    // Packs (role, size, inflated) into a table index
+    constexpr std::size_t profileIndex(Role role, FishSize size, bool inflated) noexcept
+    {
+        return (static_cast<std::size_t>(role) * SizeCount + static_cast<std::size_t>(size)) * 2
+            + (inflated ? 1u : 0u);
+    }
+
+    inline std::size_t profileOf(const Entity& entity) noexcept
+    {
+        return profileIndex(roleOf(entity.getKind()), entity.getSizeClass(), entity.isInflated());
+    }
+
+    namespace detail
+    {
+        constexpr bool rule(Role predator, FishSize predatorSize, bool predatorInflated,
+                            Role prey, FishSize preySize, bool preyInflated) noexcept
+        {
+            const int predatorRank = static_cast<int>(predatorSize);
+            const int preyRank = static_cast<int>(preySize);
+
+            switch (predator)
+            {
+            case Role::Player:
+                // The player eats any fish up to its own size
+                return prey == Role::Fish && predatorRank >= preyRank;
+            case Role::Fish:
+                // Inflated pufferfish neither eat nor get eaten
+                if (predatorInflated || prey == Role::None)
+                    return false;
+                if (prey == Role::Fish && preyInflated)
+                    return false;
+                return predatorRank > preyRank;
+            default:
+                return false;
+            }
+        }
+
+        constexpr auto buildTable()
+        {
+            std::array<std::array<bool, ProfileCount>, ProfileCount> table{};
+            constexpr std::array roles{ Role::None, Role::Player, Role::Fish };
+            constexpr std::array sizes{ FishSize::Small, FishSize::Medium, FishSize::Large };
+
+            for (Role predator : roles)
+                for (FishSize predatorSize : sizes)
+                    for (bool predatorInflated : { false, true })
+                        for (Role prey : roles)
+                            for (FishSize preySize : sizes)
+                                for (bool preyInflated : { false, true })
+                                {
+                                    table[profileIndex(predator, predatorSize, predatorInflated)]
+                                         [profileIndex(prey, preySize, preyInflated)] =
+                                        rule(predator, predatorSize, predatorInflated,
+                                             prey, preySize, preyInflated);
+                                }
+            return table;
+        }
+
+        inline constexpr auto table = buildTable();
+    }
+
+    constexpr bool canEat(std::size_t predatorProfile, std::size_t preyProfile) noexcept
+    {
+        return detail::table[predatorProfile][preyProfile];
+    }
+
+    // Size/kind/inflation rule only; callers add transient checks such as invulnerability
+    inline bool canEat(const Entity& predator, const Entity& prey) noexcept
+    {
+        return canEat(profileOf(predator), profileOf(prey));
+    }
+}
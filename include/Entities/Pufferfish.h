@@ -22,27 +22,26 @@ public:
 
     void update(sf::Time deltaTime) override;
     void initializeSprite(SpriteManager& spriteManager);
-    bool canEat(const Entity& other) const;
-
-    bool isInflated() const { return m_isPuffed; }
-
     void pushEntity(Entity& entity);
     bool canPushEntity(const Entity& entity) const;
 
     void onCollide(Player& player, CollisionSystem& system) override;
 
+    // Spikes are shapes, so only the deflated fish batches
+    bool appendToBatch(SpriteBatch& batch) const override;
+
 protected:
-    void draw(sf::RenderTarget& target, sf::RenderStates states) const override;
+    void draw(DrawList& target, sf::RenderStates states) const override;
 
 private:
     void updateCycleState(sf::Time deltaTime);
+    void updateSpikes();
     void transitionToInflated();
     void transitionToNormal();
 
     enum class PuffPhase { None, Inflating, Holding, Deflating };
 
 private:
-    bool m_isPuffed;
     sf::Time m_stateTimer;
     float m_inflationLevel;
     float m_normalRadius;
@@ -61,6 +60,9 @@ private:
     sf::Time m_puffTimer{ sf::Time::Zero };
     static constexpr float m_puffAnimDuration = 0.6f;
     PuffPhase m_puffPhase{ PuffPhase::None };
+
+    // Time until the next bounce may push the player and cost points
+    sf::Time m_bounceCooldown{ sf::Time::Zero };
 };
 
 } // namespace FishGame
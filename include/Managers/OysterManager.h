@@ -2,6 +2,7 @@
 
 #include "BonusItem.h"
 #include "SpriteManager.h"
+#include "StateUtils.h"
 #include <array>
 #include <algorithm>
 #include <random>
@@ -17,6 +18,7 @@ namespace FishGame
 
         void update(sf::Time deltaTime) override;
         void onCollect() override;
+        bool appendToBatch(SpriteBatch& batch) const override;
 
         // Sprite setup
         void initializeSprites(SpriteManager& spriteManager);
@@ -67,6 +69,9 @@ namespace FishGame
         const sf::Texture* m_oysterTexture{ nullptr };
         const sf::Texture* m_whitePearlTex{ nullptr };
         const sf::Texture* m_blackPearlTex{ nullptr };
+        sf::Vector2i m_oysterOffset;
+        sf::IntRect m_whitePearlRect;
+        sf::IntRect m_blackPearlRect;
         bool m_hasPearlSprite{ false };
 
         void updateAnimation(sf::Time dt);
@@ -74,7 +79,7 @@ namespace FishGame
         void spawnPearl();
 
     protected:
-        void draw(sf::RenderTarget& target, sf::RenderStates states) const override;
+        void draw(DrawList& target, sf::RenderStates states) const override;
     };
 
     // Template-based oyster management system
@@ -96,14 +101,21 @@ namespace FishGame
                 });
         }
 
-        void draw(sf::RenderTarget& target) const
+        void draw(DrawList& target) const
         {
+            const sf::FloatRect area = StateUtils::cullArea(target);
             std::for_each(m_oysters.begin(), m_oysters.end(),
-                [&target](const auto& oyster) {
-                    target.draw(*oyster);
+                [&target, &area](const auto& oyster) {
+                    if (oyster->getBounds().intersects(area))
+                        target.draw(*oyster);
                 });
         }
 
+        void draw(DrawList& target, SpriteBatch& batch) const
+        {
+            StateUtils::renderBatched(m_oysters, target, batch);
+        }
+
         // Template method for collision checking
         template<typename CollisionFunc>
         void checkCollisions(const Entity& entity, CollisionFunc&& onCollision)
@@ -117,6 +129,9 @@ namespace FishGame
                 });
         }
 
+        static constexpr std::size_t getCount() { return OysterCount; }
+        PermanentOyster& getOyster(std::size_t index) { return *m_oysters[index]; }
+
         void resetAll()
         {
             std::for_each(m_oysters.begin(), m_oysters.end(),
@@ -2,6 +2,7 @@
 
 #include "SpriteComponent.h"
 #include "ResourceHolder.h"
+#include "TextureAtlas.h"
 #include "Fish.h"
 #include <memory>
 #include <string>
@@ -97,9 +98,17 @@ namespace FishGame
         // Load all textures
         void loadTextures(const std::string& assetPath);
 
-        // Get texture for entity
+        // Get texture for entity; gameplay textures share atlas pages, so
+        // pair this with getTextureRect
         const sf::Texture& getTexture(TextureID id) const;
 
+        // Area of getTexture(id) holding this image
+        sf::IntRect getTextureRect(TextureID id) const;
+        sf::Vector2i getTextureOffset(TextureID id) const;
+
+        // First animation frame of a sprite sheet, or the whole image
+        sf::IntRect getFirstFrameRect(TextureID id) const;
+
         // Create sprite component for entity
         template<typename EntityType>
         std::unique_ptr<SpriteComponent<EntityType>> createSpriteComponent(
@@ -117,9 +126,16 @@ namespace FishGame
         ResourceHolder<sf::Texture, TextureID>& m_textureHolder;
         SpriteScaleConfig m_scaleConfig;
 
+        // Gameplay sheets packed at load time
+        TextureAtlas m_atlas;
+        std::unordered_map<TextureID, std::size_t> m_atlasHandles;
+
         // Texture file mappings
         static const TextureMap s_textureFiles;
 
+        // Sprites drawn during play go in the atlas; full-screen art does not
+        static bool isAtlased(TextureID id);
+
         // Helper to determine scale based on size
         float getScaleForSize(FishSize size) const;
     };
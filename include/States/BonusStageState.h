@@ -1,11 +1,15 @@
 #pragma once
 
 #include "State.h"
+#include "BackgroundCache.h"
 #include "BonusItem.h"
 #include "EnvironmentSystem.h"
 #include "CameraController.h"
 #include "Player.h"
 #include "Hazard.h"
+#include "CollisionFilter.h"
+#include "SpatialGrid.h"
+#include "SpriteBatch.h"
 #include <SFML/Graphics.hpp>
 #include <memory>
 #include <vector>
@@ -47,7 +51,7 @@ namespace FishGame
 
         void handleEvent(const sf::Event& event) override;
         bool update(sf::Time deltaTime) override;
-        void render() override;
+        void render(DrawList& target) override;
         void onActivate() override;
         void onDeactivate() override;
 
@@ -79,7 +83,10 @@ namespace FishGame
         int calculateBonus() const;
 
         // Camera handling
-        void updateCamera();
+        void updateCamera(sf::Time deltaTime);
+
+        // Broad-phase for explosions
+        void rebuildCollisionGrid();
 
         // Template helper for spawning entities
         template<typename EntityType, typename... Args>
@@ -101,7 +108,13 @@ namespace FishGame
         std::vector<std::unique_ptr<BonusItem>> m_bonusItems;
         std::vector<std::unique_ptr<Hazard>> m_hazards;
         std::unique_ptr<EnvironmentSystem> m_environment;
-        sf::Sprite m_backgroundSprite;
+        BackgroundCache m_background;
+        CollisionFilter m_collisionFilter{ CollisionFilter::standard() };
+        SpriteBatch m_spriteBatch;
+        SpatialGrid m_collisionGrid{ sf::FloatRect(0.f, 0.f,
+                                                   static_cast<float>(Constants::WINDOW_WIDTH),
+                                                   static_cast<float>(Constants::WINDOW_HEIGHT)),
+                                     Constants::COLLISION_CELL_SIZE };
 
         // Stage state
         sf::Time m_timeLimit = sf::Time::Zero;
@@ -16,9 +16,10 @@ public:
 
   void handleEvent(const sf::Event &event) override;
   bool update(sf::Time deltaTime) override;
-  void render() override;
+  void render(DrawList& target) override;
   void onActivate() override;
   void updateVolumeTexts();
+  void updateTickRateText();
 
 private:
   sf::Text m_titleText;
@@ -27,6 +28,7 @@ private:
   sf::Text m_controlsText;
   sf::Text m_musicVolumeText;
   sf::Text m_soundVolumeText;
+  sf::Text m_tickRateText;
   sf::Sprite m_overlaySprite;
   struct InfoItem {
     sf::Sprite sprite;
@@ -36,6 +38,7 @@ private:
 
   void setupInfoItems();
   void updateCurrentInfo();
+  void cycleTickRate();
 
   sf::Sprite m_backButtonSprite;
   sf::Sprite m_nextButtonSprite;
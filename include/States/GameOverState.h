@@ -46,7 +46,7 @@ namespace FishGame
 
         void handleEvent(const sf::Event& event) override;
         bool update(sf::Time deltaTime) override;
-        void render() override;
+        void render(DrawList& target) override;
         void onActivate() override;
 
     private:
@@ -104,10 +104,10 @@ namespace FishGame
         void updateMenuVisuals();
 
         // Render helpers
-        void renderBackground();
-        void renderStats();
-        void renderMenu();
-        void renderParticles();
+        void renderBackground(DrawList& target);
+        void renderStats(DrawList& target);
+        void renderMenu(DrawList& target);
+        void renderParticles(DrawList& target);
 
         // Utility methods
         void centerText(sf::Text& text, float yPosition);
@@ -124,8 +124,8 @@ namespace FishGame
                 particle.shape.setRadius(std::uniform_real_distribution<float>(2.0f, 6.0f)(gen));
                 particle.shape.setFillColor(sf::Color(255, 255, 255, 40));
                 particle.shape.setPosition(
-                    std::uniform_real_distribution<float>(0, getGame().getWindow().getSize().x)(gen),
-                    getGame().getWindow().getSize().y + 20.0f
+                    std::uniform_real_distribution<float>(0, getGame().getWindowSize().x)(gen),
+                    getGame().getWindowSize().y + 20.0f
                 );
                 particle.velocity = sf::Vector2f(
                     std::uniform_real_distribution<float>(-20.0f, 20.0f)(gen),
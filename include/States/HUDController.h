@@ -2,7 +2,6 @@
 
 #include "HUDSystem.h"
 #include <memory>
-#include <vector>
 
 namespace FishGame {
 
@@ -10,15 +9,7 @@ class HUDController {
 public:
     HUDController(const sf::Font& font, const sf::Vector2u& windowSize);
 
-    void update(sf::Time dt,
-                int score,
-                int lives,
-                int level,
-                int chainBonus,
-                const std::vector<PowerUpType>& active,
-                bool frozen, sf::Time freeze,
-                bool reversed, sf::Time reverse,
-                bool stunned, sf::Time stun);
+    void update(sf::Time dt, const HUDState& state);
 
     void showMessage(const std::string& msg) { m_hud->showMessage(msg); }
     HUDSystem& getSystem() { return *m_hud; }
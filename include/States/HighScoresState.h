@@ -28,7 +28,7 @@ public:
 
     void handleEvent(const sf::Event& event) override;
     bool update(sf::Time dt) override;
-    void render() override;
+    void render(DrawList& target) override;
     void onActivate() override;
 
 private:
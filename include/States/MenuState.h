@@ -26,7 +26,7 @@ namespace FishGame
 
         void handleEvent(const sf::Event& event) override;
         bool update(sf::Time deltaTime) override;
-        void render() override;
+        void render(DrawList& target) override;
         void onActivate() override;
 
     private:
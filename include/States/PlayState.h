@@ -4,6 +4,8 @@
 #include "EnhancedFishSpawner.h"
 #include "SchoolingSystem.h"
 #include "CollisionSystem.h"
+#include "AISystem.h"
+#include "BackgroundCache.h"
 #include "GrowthMeter.h"
 #include "FrenzySystem.h"
 #include "BonusItemManager.h"
@@ -52,7 +54,7 @@ namespace FishGame
 
         void handleEvent(const sf::Event& event) override;
         bool update(sf::Time deltaTime) override;
-        void render() override;
+        void render(DrawList& target) override;
         void onActivate() override;
         void onDeactivate() override;
 
@@ -88,7 +90,7 @@ namespace FishGame
         void updateEntities(sf::Time deltaTime);
         void updateGameState(sf::Time deltaTime);
         void updateSystems(sf::Time deltaTime);
-        void updateCamera();
+        void updateCamera(sf::Time deltaTime);
 
         // Collision handling
         void handlePowerUpCollision(PowerUp& powerUp);
@@ -153,10 +155,12 @@ namespace FishGame
 
         std::unique_ptr<ParticleSystem> m_particleSystem;
         std::unique_ptr<CollisionSystem> m_collisionSystem;
+        AISystem m_aiSystem;
 
         // Camera and background
-        sf::Sprite m_backgroundSprite;
+        BackgroundCache m_background;
         CameraController m_camera;
+        SpriteBatch m_spriteBatch;
 
         // Random number generation
         std::mt19937 m_randomEngine;
@@ -33,7 +33,7 @@ public:
 
   void handleEvent(const sf::Event &event) override;
   bool update(sf::Time deltaTime) override;
-  void render() override;
+  void render(DrawList& target) override;
   void onActivate() override;
 
 private:
@@ -0,0 +1,50 @@
+#pragma once
+
+#include "Entity.h"
+#include "Predation.h"
+#include <vector>
+
+namespace FishGame
+{
+    // Read-only copy of the state an AI decision may look at
+    struct AIEntityState
+    {
+        const Entity* entity = nullptr;
+        sf::Vector2f position{};
+        float radius = 0.0f;
+        EntityType type = EntityType::None;
+        FishSize size{};
+        bool isFish = false;
+        bool isPufferfish = false;
+        bool isInflated = false;
+        bool isInvulnerable = false;
+        std::size_t predation = 0;   // Predation::profileIndex of this entity
+
+        // Lets EntityUtils distance helpers work on captured state
+        const sf::Vector2f& getPosition() const noexcept { return position; }
+        float getRadius() const noexcept { return radius; }
+    };
+
+    // World state captured once per tick before any fish decides what to do.
+    // Decisions only read from the snapshot, so they can run in any order.
+    struct AISnapshot
+    {
+        std::vector<AIEntityState> entities;
+        AIEntityState player;
+        bool hasPlayer = false;
+
+        void clear()
+        {
+            entities.clear();
+            player = AIEntityState{};
+            hasPlayer = false;
+        }
+
+        // Mirrors Fish::canEat / Player::canEat on captured state
+        static bool canEat(const AIEntityState& predator, const AIEntityState& prey)
+        {
+            return !predator.isInvulnerable &&
+                Predation::canEat(predator.predation, prey.predation);
+        }
+    };
+}
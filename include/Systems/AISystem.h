@@ -0,0 +1,74 @@
+#pragma once
+
+#include "AISnapshot.h"
+#include "GameConstants.h"
+#include <cstdint>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+namespace FishGame
+{
+    class Fish;
+    class Player;
+
+    // Runs fish AI in two phases: every fish plans against the same per-tick
+    // snapshot (in parallel), then the plans are applied serially.
+    //
+    // Planning is level-of-detail scheduled: a fish's tier comes from its
+    // distance to the player or camera and sets how often it plans (every
+    // 1st/2nd/4th/8th tick, staggered by id). Due fish are planned in chunks
+    // until the per-tick budget runs out; the rest carry over with priority.
+    // Tier distances shrink while the budget overruns and recover after.
+    class AISystem
+    {
+    public:
+        void update(const std::vector<std::unique_ptr<Entity>>& entities,
+            const Player* player, sf::Time deltaTime);
+
+        // Second LOD focus besides the player, usually the camera centre
+        void setCameraFocus(sf::Vector2f focus) { m_cameraFocus = focus; m_hasCameraFocus = true; }
+
+        void setBudget(sf::Time budget) { m_budget = budget; }
+        std::size_t getDeferredCount() const noexcept { return m_deferredCount; }
+
+        static AIEntityState capture(const Entity& entity);
+        static AIEntityState capture(const Player& player);
+
+    private:
+        void captureSnapshot(const std::vector<std::unique_ptr<Entity>>& entities,
+            const Player* player);
+
+        struct Schedule
+        {
+            sf::Time pending{ sf::Time::Zero };   // time since the last plan
+            std::uint64_t lastSeen{ 0 };
+            bool overdue{ false };                // deferred by the budget
+        };
+
+        struct Agent
+        {
+            Fish* fish;
+            std::size_t slot;   // index into m_snapshot.entities
+            std::uint8_t tier{ 0 };
+            Schedule* schedule{ nullptr };
+        };
+
+        std::uint8_t tierFor(sf::Vector2f position) const;
+        bool isDue(EntityId id, std::uint8_t tier) const;
+        void rebalance(bool overran, sf::Time used);
+
+        AISnapshot m_snapshot;
+        std::vector<Agent> m_agents;
+        std::vector<Agent> m_due;
+        std::unordered_map<EntityId, Schedule> m_schedules;
+
+        std::uint64_t m_tick{ 0 };
+        std::uint64_t m_ticksPerPlan{ 1 };
+        sf::Vector2f m_cameraFocus{};
+        bool m_hasCameraFocus{ false };
+        sf::Time m_budget{ sf::microseconds(static_cast<sf::Int64>(Constants::AI_TICK_BUDGET_MS * 1000.0f)) };
+        float m_lodScale{ 1.0f };
+        std::size_t m_deferredCount{ 0 };
+    };
+}
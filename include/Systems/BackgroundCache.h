@@ -0,0 +1,35 @@
+#pragma once
+
+#include <SFML/Graphics.hpp>
+#include "DrawList.h"
+
+namespace FishGame
+{
+    // Level backdrop composited with the time-of-day tint into one render
+    // layer. The composite keeps the source texture's resolution so the
+    // zoomed camera samples as much detail as it did from the texture
+    // itself; it is re-recorded only when the texture or tint changes, so a
+    // frame costs one blit instead of a sprite plus a full-screen overlay.
+    class BackgroundCache : public Renderable
+    {
+    public:
+        BackgroundCache();
+
+        // Stretches the texture over a (0, 0)-anchored area of the given size
+        void setTexture(const sf::Texture& texture, sf::Vector2u size);
+        void setTint(const sf::Color& tint);
+
+    protected:
+        void draw(DrawList& target, sf::RenderStates states) const override;
+
+    private:
+        // Draws the backdrop and tint over an area of the given size
+        void drawComposite(DrawList& target, sf::RenderStates states, sf::Vector2u size) const;
+        void refresh();
+
+        const sf::Texture* m_texture{ nullptr };
+        sf::Vector2u m_size{};
+        sf::Color m_tint{ sf::Color::Transparent };
+        RenderLayer m_composite;
+    };
+}
@@ -1,6 +1,8 @@
 #pragma once
 
 #include <SFML/Graphics.hpp>
+#include "DrawHelpers.h"
+#include "GameConstants.h"
 
 namespace FishGame
 {
@@ -9,19 +11,26 @@ namespace FishGame
     public:
         CameraController() = default;
         CameraController(const sf::View& view, sf::Vector2f worldSize,
-            float smoothing = 0.1f);
+            float smoothing = Constants::CAMERA_FOLLOW_RATE);
 
-        void setView(const sf::View& view) { m_view = view; }
+        void setView(const sf::View& view) { m_view = view; m_previousCenter = view.getCenter(); }
         sf::View& getView() { return m_view; }
         const sf::View& getView() const { return m_view; }
+        sf::FloatRect getVisibleArea(float margin = 0.f) const { return DrawUtils::visibleArea(m_view, margin); }
 
         void setWorldSize(sf::Vector2f size) { m_worldSize = size; }
         sf::Vector2f getWorldSize() const { return m_worldSize; }
 
+        // Smoothing is a follow rate per second, independent of the tick rate
         void setSmoothing(float smoothing) { m_smoothing = smoothing; }
         float getSmoothing() const { return m_smoothing; }
 
-        void update(const sf::Vector2f& targetPos);
+        void update(const sf::Vector2f& targetPos, sf::Time deltaTime);
+
+        // Render interpolation: store before each tick, then render through
+        // the view placed alpha of the way from the stored to the current centre
+        void storePreviousCenter() { m_previousCenter = m_view.getCenter(); }
+        sf::View getInterpolatedView(float alpha) const;
 
         void freeze(const sf::Vector2f& position);
         void unfreeze();
@@ -29,10 +38,11 @@ namespace FishGame
 
     private:
         sf::View m_view{};
+        sf::Vector2f m_previousCenter{};
         sf::Vector2f m_worldSize{};
         bool m_frozen{false};
         sf::Vector2f m_frozenPos{};
-        float m_smoothing{0.1f};
+        float m_smoothing{Constants::CAMERA_FOLLOW_RATE};
     };
 }
 
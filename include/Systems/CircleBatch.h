@@ -0,0 +1,37 @@
+#pragma once
+
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+
+namespace FishGame::CircleBatch
+{
+    // Largest batch overlapMask handles in one call
+    constexpr std::size_t MaxBatch = 32;
+
+    // Tests one circle against up to MaxBatch packed circles. Bit i is set
+    // when circle i strictly overlaps, using the same squared test as
+    // EntityUtils::areColliding. Uses AVX or SSE when the build targets
+    // them and a scalar loop otherwise.
+    std::uint32_t overlapMask(float x, float y, float radius,
+                              const float* xs, const float* ys, const float* radii,
+                              std::size_t count) noexcept;
+
+    // Calls func(i) for every packed circle overlapping (x, y, radius)
+    template<typename Func>
+    void forEachOverlap(float x, float y, float radius,
+                        const float* xs, const float* ys, const float* radii,
+                        std::size_t count, Func&& func)
+    {
+        for (std::size_t base = 0; base < count; base += MaxBatch)
+        {
+            const std::size_t batch = count - base < MaxBatch ? count - base : MaxBatch;
+            std::uint32_t hits = overlapMask(x, y, radius, xs + base, ys + base, radii + base, batch);
+            while (hits != 0)
+            {
+                func(base + static_cast<std::size_t>(std::countr_zero(hits)));
+                hits &= hits - 1;
+            }
+        }
+    }
+}
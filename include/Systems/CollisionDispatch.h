@@ -0,0 +1,126 @@
+#pragma once
+
+#include "Entity.h"
+#include "GameConstants.h"
+#include <array>
+#include <cstddef>
+
+namespace FishGame
+{
+    class CollisionSystem;
+
+    // Response for an overlapping pair, called with (a, b) in table order
+    using CollisionResponse = void (*)(Entity&, Entity&, CollisionSystem&);
+
+    namespace CollisionResponses
+    {
+        void playerTouches(Entity& player, Entity& other, CollisionSystem& system);
+        void playerOyster(Entity& player, Entity& oyster, CollisionSystem& system);
+        void fishFish(Entity& a, Entity& b, CollisionSystem& system);
+        void fishBomb(Entity& fish, Entity& bomb, CollisionSystem& system);
+        void fishJellyfish(Entity& fish, Entity& jellyfish, CollisionSystem& system);
+        void fishOyster(Entity& fish, Entity& oyster, CollisionSystem& system);
+
+        // Lets one response serve both (A, B) and (B, A)
+        template<CollisionResponse Response>
+        void swapped(Entity& a, Entity& b, CollisionSystem& system)
+        {
+            Response(b, a, system);
+        }
+    }
+
+    constexpr std::size_t EntityKindCount = static_cast<std::size_t>(EntityKind::Count);
+    using CollisionTable = std::array<std::array<CollisionResponse, EntityKindCount>, EntityKindCount>;
+
+    namespace detail
+    {
+        constexpr CollisionTable buildCollisionTable()
+        {
+            using namespace CollisionResponses;
+            using K = EntityKind;
+
+            CollisionTable table{};
+            auto set = [&table](K a, K b, CollisionResponse response)
+                {
+                    table[static_cast<std::size_t>(a)][static_cast<std::size_t>(b)] = response;
+                };
+            auto setBoth = [&set](K a, K b, CollisionResponse response, CollisionResponse mirrored)
+                {
+                    set(a, b, response);
+                    set(b, a, mirrored);
+                };
+
+            constexpr std::array fishKinds{ K::Fish, K::Pufferfish, K::PoisonFish };
+            for (K fish : fishKinds)
+            {
+                setBoth(K::Player, fish, &playerTouches, &swapped<&playerTouches>);
+                setBoth(fish, K::Bomb, &fishBomb, &swapped<&fishBomb>);
+                setBoth(fish, K::Jellyfish, &fishJellyfish, &swapped<&fishJellyfish>);
+                setBoth(fish, K::Oyster, &fishOyster, &swapped<&fishOyster>);
+
+                for (K other : fishKinds)
+                    set(fish, other, &fishFish);
+            }
+
+            setBoth(K::Player, K::Bomb, &playerTouches, &swapped<&playerTouches>);
+            setBoth(K::Player, K::Jellyfish, &playerTouches, &swapped<&playerTouches>);
+            setBoth(K::Player, K::Bonus, &playerTouches, &swapped<&playerTouches>);
+            setBoth(K::Player, K::Oyster, &playerOyster, &swapped<&playerOyster>);
+
+            return table;
+        }
+
+        // Seconds between repeated responses for a lasting contact; 0 means every tick
+        using RepeatTable = std::array<std::array<float, EntityKindCount>, EntityKindCount>;
+
+        constexpr RepeatTable buildRepeatTable()
+        {
+            using K = EntityKind;
+
+            RepeatTable table{};
+            auto setBoth = [&table](K a, K b, float seconds)
+                {
+                    table[static_cast<std::size_t>(a)][static_cast<std::size_t>(b)] = seconds;
+                    table[static_cast<std::size_t>(b)][static_cast<std::size_t>(a)] = seconds;
+                };
+
+            // Jellyfish stun on first touch and again once the stun wears off
+            for (K kind : { K::Player, K::Fish, K::Pufferfish, K::PoisonFish })
+                setBoth(kind, K::Jellyfish, Constants::JELLYFISH_CONTACT_REPEAT);
+
+            return table;
+        }
+    }
+
+    // Compile-time 2D table of pair responses indexed by (kindA, kindB)
+    class CollisionDispatch
+    {
+    public:
+        CollisionDispatch() = delete;
+
+        static constexpr CollisionResponse lookup(EntityKind a, EntityKind b) noexcept
+        {
+            return s_table[static_cast<std::size_t>(a)][static_cast<std::size_t>(b)];
+        }
+
+        // Runs the registered response, if any; returns whether one existed
+        static bool dispatch(Entity& a, Entity& b, CollisionSystem& system)
+        {
+            if (CollisionResponse response = lookup(a.getKind(), b.getKind()))
+            {
+                response(a, b, system);
+                return true;
+            }
+            return false;
+        }
+
+        static constexpr float repeatSeconds(EntityKind a, EntityKind b) noexcept
+        {
+            return s_repeat[static_cast<std::size_t>(a)][static_cast<std::size_t>(b)];
+        }
+
+    private:
+        static constexpr CollisionTable s_table = detail::buildCollisionTable();
+        static constexpr detail::RepeatTable s_repeat = detail::buildRepeatTable();
+    };
+}
@@ -0,0 +1,77 @@
+#pragma once
+
+#include "Entity.h"
+#include <array>
+#include <bit>
+
+namespace FishGame
+{
+    // Symmetric layer-vs-layer matrix. Each game state owns one so it can
+    // decide which pairs are worth generating at all.
+    class CollisionFilter
+    {
+    public:
+        constexpr CollisionFilter() = default;
+
+        // Rules used by the main game: the player touches everything, fish
+        // of different sizes can eat each other, and fish react to hazards
+        // and oysters. Same-size fish and bonus-vs-hazard never interact.
+        static constexpr CollisionFilter standard()
+        {
+            namespace L = CollisionLayer;
+            CollisionFilter filter;
+            filter.allow(L::Player, L::AnyFish | L::Hazard | L::Bonus | L::Oyster);
+            filter.allow(L::SmallFish, L::MediumFish | L::LargeFish);
+            filter.allow(L::MediumFish, L::LargeFish);
+            filter.allow(L::AnyFish, L::Hazard | L::Oyster);
+            return filter;
+        }
+
+        constexpr void allow(LayerMask a, LayerMask b) { set(a, b, true); }
+        constexpr void deny(LayerMask a, LayerMask b) { set(a, b, false); }
+
+        // Layers that may touch any layer in `category`
+        constexpr LayerMask maskFor(LayerMask category) const noexcept
+        {
+            // Entities sit on exactly one layer, so this is the hot path
+            if (std::has_single_bit(category) && category < (1u << CollisionLayer::Count))
+                return m_masks[static_cast<std::size_t>(std::countr_zero(category))];
+
+            LayerMask mask = CollisionLayer::None;
+            for (std::size_t i = 0; i < CollisionLayer::Count; ++i)
+            {
+                if (category & (1u << i))
+                    mask = static_cast<LayerMask>(mask | m_masks[i]);
+            }
+            return mask;
+        }
+
+        constexpr bool accepts(LayerMask categoryA, LayerMask maskA,
+                               LayerMask categoryB, LayerMask maskB) const noexcept
+        {
+            return (maskFor(categoryA) & maskA & categoryB) != 0 &&
+                   (maskB & categoryA) != 0;
+        }
+
+        bool shouldCollide(const Entity& a, const Entity& b) const noexcept
+        {
+            return accepts(a.getCollisionCategory(), a.getCollisionMask(),
+                           b.getCollisionCategory(), b.getCollisionMask());
+        }
+
+    private:
+        constexpr void set(LayerMask a, LayerMask b, bool enabled)
+        {
+            for (std::size_t i = 0; i < CollisionLayer::Count; ++i)
+            {
+                const LayerMask bit = static_cast<LayerMask>(1u << i);
+                if (a & bit)
+                    m_masks[i] = static_cast<LayerMask>(enabled ? (m_masks[i] | b) : (m_masks[i] & ~b));
+                if (b & bit)
+                    m_masks[i] = static_cast<LayerMask>(enabled ? (m_masks[i] | a) : (m_masks[i] & ~a));
+            }
+        }
+
+        std::array<LayerMask, CollisionLayer::Count> m_masks{};
+    };
+}
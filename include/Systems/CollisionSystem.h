@@ -4,6 +4,7 @@
 #include <memory>
 #include <functional>
 #include <unordered_map>
+#include <cstdint>
 
 #include "Player.h"
 #include "BonusItem.h"
@@ -16,9 +17,36 @@
 #include "IPowerUpManager.h"
 #include "OysterManager.h"
 #include "FishCollisionHandler.h"
+#include "CollisionFilter.h"
+#include "SpatialGrid.h"
+#include "ContactCache.h"
 
 namespace FishGame
 {
+    // Contact categories, listed in resolution order
+    enum class ContactType : std::uint8_t
+    {
+        PlayerEntity,
+        PlayerBonus,
+        PlayerHazard,
+        PlayerOyster,
+        EntityEntity,
+        EntityHazard,
+        EntityOyster
+    };
+
+    // Overlapping pair recorded by the detection phase
+    struct Contact
+    {
+        Entity* a;
+        Entity* b;
+        ContactType type;
+        float penetration;
+        std::uint32_t indexA;   // container slots, used as sort keys
+        std::uint32_t indexB;
+        bool swept;             // either side moved fast enough to be swept
+    };
+
     class CollisionSystem
     {
     public:
@@ -36,7 +64,12 @@ namespace FishGame
                      std::vector<std::unique_ptr<Entity>>& entities,
                      std::vector<std::unique_ptr<BonusItem>>& bonusItems,
                      std::vector<std::unique_ptr<Hazard>>& hazards,
-                     FixedOysterManager* oysters, int currentLevel);
+                     FixedOysterManager* oysters, int currentLevel,
+                     sf::Time deltaTime);
+
+        // Layer pairs this state wants contacts for
+        void setFilter(const CollisionFilter& filter) { m_filter = filter; }
+        const CollisionFilter& getFilter() const { return m_filter; }
 
     public:
         // Exposed for entity collision handlers
@@ -44,6 +77,13 @@ namespace FishGame
         void handlePowerUpCollision(Player& player, PowerUp& powerUp);
         void handleOysterCollision(Player& player, PermanentOyster* oyster);
 
+        // Defers the death callback until every contact has been resolved
+        void requestPlayerDeath() { m_playerDeathPending = true; }
+        bool isPlayerDeathPending() const { return m_playerDeathPending; }
+
+        // Whether the contact being resolved was found by a swept test; its
+        // response should then judge reach along the motion, not at the end
+        bool isContactSwept() const { return m_contactSwept; }
 
         ParticleSystem& m_particles;
         IScoreSystem& m_scoreSystem;
@@ -58,5 +98,69 @@ namespace FishGame
         std::function<void()> m_onPlayerDeath;
         std::function<void()> m_applyFreeze;
         std::function<void()> m_reverseControls;
+
+    private:
+        void detectContacts(Player& player,
+                            std::vector<std::unique_ptr<Entity>>& entities,
+                            std::vector<std::unique_ptr<BonusItem>>& bonusItems,
+                            std::vector<std::unique_ptr<Hazard>>& hazards,
+                            FixedOysterManager* oysters, int currentLevel);
+        void resolveContacts(Player& player);
+        void resolveContact(Player& player, const Contact& contact);
+
+        // Motion since the last pass; slow movers and teleports collapse to a point
+        struct Sweep
+        {
+            sf::Vector2f start;
+            sf::Vector2f delta;
+            bool swept;
+
+            sf::Vector2f center() const { return start + delta * 0.5f; }
+        };
+        static Sweep sweepOf(const Entity& entity) noexcept;
+        static float sweepReach(const Entity& entity, const Sweep& sweep) noexcept;
+        // Discrete test, or time-of-impact when either side moved fast
+        static bool touching(const Entity& a, const Entity& b) noexcept;
+
+        void addToGrid(Entity& entity, std::uint32_t group, std::size_t index);
+        void endSweeps(Player& player,
+                       std::vector<std::unique_ptr<Entity>>& entities,
+                       std::vector<std::unique_ptr<BonusItem>>& bonusItems,
+                       std::vector<std::unique_ptr<Hazard>>& hazards,
+                       FixedOysterManager* oysters);
+
+        // Rebuilds the static grid only when bonus items or oysters come or go
+        void refreshStaticGrid(std::vector<std::unique_ptr<BonusItem>>& bonusItems,
+                               FixedOysterManager* oysters);
+        void detectStatic(Entity& entity, std::size_t index, LayerMask layers,
+                          ContactType bonusContact, ContactType oysterContact);
+
+        void addContact(Entity& a, Entity& b, ContactType type,
+                        std::size_t indexA, std::size_t indexB);
+
+        // Proxy groups inside the broad-phase grid
+        static constexpr std::uint32_t EntityGroup = 0;
+        static constexpr std::uint32_t HazardGroup = 1;
+        static constexpr std::uint32_t BonusGroup = 2;
+        static constexpr std::uint32_t OysterGroup = 3;
+
+        // Identity of one static grid member; the anchor catches a freed
+        // slot being reused by a different item
+        struct StaticKey
+        {
+            const Entity* entity;
+            sf::Vector2f anchor;
+            bool operator==(const StaticKey&) const = default;
+        };
+
+        std::vector<Contact> m_contacts;
+        ContactCache m_contactCache;
+        SpatialGrid m_grid;          // fish and hazards, rebuilt every tick
+        SpatialGrid m_staticGrid;    // bobbing bonus items and oysters
+        std::vector<StaticKey> m_staticKeys;
+        std::vector<StaticKey> m_pendingKeys;
+        CollisionFilter m_filter{ CollisionFilter::standard() };
+        bool m_playerDeathPending{ false };
+        bool m_contactSwept{ false };
     };
 }
@@ -0,0 +1,50 @@
+#pragma once
+
+#include "Entity.h"
+#include <cstdint>
+#include <unordered_map>
+#include <utility>
+
+namespace FishGame
+{
+    // Overlapping pairs remembered across ticks, keyed by entity ids so a
+    // recycled address never inherits an old contact
+    class ContactCache
+    {
+    public:
+        // Starts a tick; pairs not touched before endTick() have ended
+        void beginTick(sf::Time deltaTime);
+
+        // Marks the pair as overlapping this tick
+        void touch(const Entity& a, const Entity& b);
+
+        // Whether a response should run now: on begin, then at most once per
+        // repeatInterval while the pair stays in contact
+        bool shouldFire(const Entity& a, const Entity& b, sf::Time repeatInterval);
+
+        // Drops pairs that stopped overlapping
+        void endTick();
+
+        std::size_t size() const noexcept { return m_pairs.size(); }
+        void clear();
+
+    private:
+        struct Entry
+        {
+            std::uint64_t lastSeenTick;
+            sf::Time lastFired;
+            bool hasFired;
+        };
+
+        static std::uint64_t key(EntityId a, EntityId b) noexcept
+        {
+            if (a > b)
+                std::swap(a, b);
+            return (static_cast<std::uint64_t>(a) << 32) | b;
+        }
+
+        std::unordered_map<std::uint64_t, Entry> m_pairs;
+        std::uint64_t m_tick{ 0 };
+        sf::Time m_clock{ sf::Time::Zero };
+    };
+}
@@ -4,6 +4,7 @@
 #include <memory>
 #include <vector>
 #include <random>
+#include "DrawList.h"
 
 namespace FishGame
 {
@@ -38,17 +39,21 @@ namespace FishGame
         BackgroundLayer(float scrollSpeed, const sf::Color& color);
 
         void update(sf::Time deltaTime);
-        void draw(sf::RenderTarget& target) const;
+        void draw(DrawList& target) const;
         void setEnvironment(EnvironmentType type);
+        void setTint(const sf::Color& tint);
 
     private:
         std::vector<sf::RectangleShape> m_elements;
+        std::vector<sf::Color> m_elementColors;   // untinted fill per element
+        sf::Color m_tint{ sf::Color::Transparent };
         float m_scrollSpeed;
         float m_scrollOffset;
         sf::Color m_baseColor;
         EnvironmentType m_currentEnvironment;
 
         void generateElements();
+        void applyTint();
     };
 
     // Ocean current system affecting movement
@@ -62,7 +67,8 @@ namespace FishGame
         void setDirection(const sf::Vector2f& direction);
 
         sf::Vector2f getCurrentForce(const sf::Vector2f& position) const;
-        void drawDebug(sf::RenderTarget& target) const;
+        void drawDebug(DrawList& target) const;
+        void setTint(const sf::Color& tint);
 
     private:
         sf::Vector2f m_currentDirection;
@@ -74,7 +80,7 @@ namespace FishGame
     };
 
     // Main environment system managing all environmental features
-    class EnvironmentSystem : public sf::Drawable
+    class EnvironmentSystem : public Renderable
     {
     public:
         EnvironmentSystem();
@@ -102,13 +108,20 @@ namespace FishGame
         void pauseDayNightCycle() { m_dayNightCyclePaused = true; }
         void setRandomTimeOfDay();
 
+        // Owners that bake getAmbientLightColor() into a cached background
+        // turn off the full-screen overlay. The layers, background fish and
+        // currents still drawn every frame then carry the tint in their own
+        // colours, which blends to the same pixels as the overlay did.
+        void setLightingOverlayEnabled(bool enabled);
+
     protected:
-        void draw(sf::RenderTarget& target, sf::RenderStates states) const override;
+        void draw(DrawList& target, sf::RenderStates states) const override;
 
     private:
         void updateDayNightCycle(sf::Time deltaTime);
         void applyEnvironmentEffects();
         void transitionEnvironment(EnvironmentType newType);
+        void applyLighting();
 
     private:
         struct BackgroundFish
@@ -134,6 +147,7 @@ namespace FishGame
 
         bool m_isTransitioning;
         bool m_dayNightCyclePaused;
+        bool m_lightingOverlayEnabled{ true };
 
         // Random number generation for time of day
         std::mt19937 m_randomEngine;
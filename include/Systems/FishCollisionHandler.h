@@ -6,6 +6,8 @@
 #include "Hazard.h"
 #include "SoundPlayer.h"
 #include "CollisionDetector.h"
+#include "CollisionFilter.h"
+#include "SpatialGrid.h"
 #include <type_traits>
 #include <functional>
 #include <algorithm>
@@ -22,8 +24,9 @@ namespace FishGame
             std::for_each(entities.begin(), entities.end(),
                 [&entities](auto& entity1)
                 {
-                    if (auto* fish1 = dynamic_cast<Fish*>(entity1.get()))
+                    if (entity1 && isFishKind(entity1->getKind()))
                     {
+                        auto* fish1 = static_cast<Fish*>(entity1.get());
                         if (!fish1->isAlive() || fish1->isStunned()) return;
 
                         std::for_each(entities.begin(), entities.end(),
@@ -31,8 +34,9 @@ namespace FishGame
                             {
                                 if (entity1 == entity2) return;
 
-                                if (auto* fish2 = dynamic_cast<Fish*>(entity2.get()))
+                                if (entity2 && isFishKind(entity2->getKind()))
                                 {
+                                    auto* fish2 = static_cast<Fish*>(entity2.get());
                                     if (!fish2->isAlive()) return;
 
                                     if (CollisionDetector::checkCircleCollision(*fish1, *fish2))
@@ -48,19 +52,21 @@ namespace FishGame
         // Template method for fish-to-hazard collisions
         template<typename EntityContainer, typename HazardContainer>
         static void processFishHazardCollisions(EntityContainer& entities,
-            HazardContainer& hazards, SoundPlayer* soundPlayer = nullptr)
+            HazardContainer& hazards, SoundPlayer* soundPlayer = nullptr,
+            const CollisionFilter& filter = CollisionFilter::standard())
         {
             std::for_each(entities.begin(), entities.end(),
-                [&hazards, soundPlayer](auto& entity)
+                [&hazards, soundPlayer, &filter](auto& entity)
                 {
-                    if (auto* fish = dynamic_cast<Fish*>(entity.get()))
+                    if (entity && isFishKind(entity->getKind()))
                     {
+                        auto* fish = static_cast<Fish*>(entity.get());
                         if (!fish->isAlive()) return;
 
                         std::for_each(hazards.begin(), hazards.end(),
-                            [fish, soundPlayer](auto& hazard)
+                            [fish, soundPlayer, &filter](auto& hazard)
                             {
-                                if (!hazard->isAlive()) return;
+                                if (!hazard->isAlive() || !filter.shouldCollide(*fish, *hazard)) return;
 
                                 if (CollisionDetector::checkCircleCollision(*fish, *hazard))
                                 {
@@ -75,19 +81,21 @@ namespace FishGame
         static void handleFishToFishCollision(Fish& fish1, Fish& fish2)
         {
             // Pufferfish pushback
-            if (auto* puffer1 = dynamic_cast<Pufferfish*>(&fish1))
+            if (fish1.getKind() == EntityKind::Pufferfish)
             {
-                if (puffer1->isInflated() && puffer1->canPushEntity(fish2))
+                auto& puffer1 = static_cast<Pufferfish&>(fish1);
+                if (puffer1.isInflated() && puffer1.canPushEntity(fish2))
                 {
-                    puffer1->pushEntity(fish2);
+                    puffer1.pushEntity(fish2);
                     return;
                 }
             }
-            if (auto* puffer2 = dynamic_cast<Pufferfish*>(&fish2))
+            if (fish2.getKind() == EntityKind::Pufferfish)
             {
-                if (puffer2->isInflated() && puffer2->canPushEntity(fish1))
+                auto& puffer2 = static_cast<Pufferfish&>(fish2);
+                if (puffer2.isInflated() && puffer2.canPushEntity(fish1))
                 {
-                    puffer2->pushEntity(fish1);
+                    puffer2.pushEntity(fish1);
                     return;
                 }
             }
@@ -96,9 +104,9 @@ namespace FishGame
             if (fish1.canEat(fish2))
             {
                 // Check if eating a poison fish
-                if (auto* poisonFish = dynamic_cast<PoisonFish*>(&fish2))
+                if (fish2.getKind() == EntityKind::PoisonFish)
                 {
-                    fish1.setPoisoned(poisonFish->getPoisonDuration());
+                    fish1.setPoisoned(static_cast<PoisonFish&>(fish2).getPoisonDuration());
                 }
                 fish1.playEatAnimation();
                 fish2.destroy();
@@ -106,9 +114,9 @@ namespace FishGame
             else if (fish2.canEat(fish1))
             {
                 // Check if eating a poison fish
-                if (auto* poisonFish = dynamic_cast<PoisonFish*>(&fish1))
+                if (fish1.getKind() == EntityKind::PoisonFish)
                 {
-                    fish2.setPoisoned(poisonFish->getPoisonDuration());
+                    fish2.setPoisoned(static_cast<PoisonFish&>(fish1).getPoisonDuration());
                 }
                 fish2.playEatAnimation();
                 fish1.destroy();
@@ -117,60 +125,76 @@ namespace FishGame
 
         static void handleFishToHazardCollision(Fish& fish, Hazard& hazard, SoundPlayer* soundPlayer)
         {
-            switch (hazard.getHazardType())
+            switch (hazard.getKind())
             {
-            case HazardType::Bomb:
-                if (auto* bomb = dynamic_cast<Bomb*>(&hazard))
+            case EntityKind::Bomb:
+            {
+                auto& bomb = static_cast<Bomb&>(hazard);
+                bool wasExploding = bomb.isExploding();
+                bomb.onContact(fish);
+                if (!wasExploding && bomb.isExploding() && soundPlayer)
                 {
-                    bool wasExploding = bomb->isExploding();
-                    bomb->onContact(fish);
-                    if (!wasExploding && bomb->isExploding() && soundPlayer)
-                    {
-                        soundPlayer->play(SoundEffectID::MineExplode);
-                    }
+                    soundPlayer->play(SoundEffectID::MineExplode);
                 }
                 break;
+            }
 
-            case HazardType::Jellyfish:
-                if (auto* jellyfish = dynamic_cast<Jellyfish*>(&hazard))
-                {
-                    jellyfish->onContact(fish);
-                    fish.setStunned(jellyfish->getStunDuration());
-                }
+            case EntityKind::Jellyfish:
+            {
+                // The stun doubles as the repeat window: a lasting contact
+                // pushes again once it wears off, not on every tick
+                if (fish.isStunned())
+                    break;
+
+                auto& jellyfish = static_cast<Jellyfish&>(hazard);
+                jellyfish.onContact(fish);
+                fish.setStunned(jellyfish.getStunDuration());
+                break;
+            }
+
+            default:
                 break;
             }
         }
     };
 
-    // Template function for handling bomb explosions
-    template<typename Container>
-    void processBombExplosions(Container& entities, const std::vector<std::unique_ptr<Hazard>>& hazards)
+    // Explosion pass over a grid that holds this tick's entities and hazards.
+    // Exploding bombs only visit nearby proxies and compare squared
+    // distances. With chain reactions on, idle bombs caught in a blast are
+    // triggered and start damaging on their own next tick, so a cascade
+    // spreads one ring per tick instead of being resolved all at once.
+    inline void processBombExplosions(const SpatialGrid& grid,
+                                      const std::vector<std::unique_ptr<Hazard>>& hazards,
+                                      bool chainReactions = true)
     {
+        const LayerMask layers = static_cast<LayerMask>(
+            CollisionLayer::AnyFish | (chainReactions ? CollisionLayer::Hazard : CollisionLayer::None));
+
         std::for_each(hazards.begin(), hazards.end(),
-            [&entities](const auto& hazard)
+            [&grid, layers](const auto& hazard)
             {
-                if (auto* bomb = dynamic_cast<Bomb*>(hazard.get()))
-                {
-                    if (bomb->isExploding())
-                    {
-                        sf::Vector2f bombPos = bomb->getPosition();
-                        float explosionRadius = bomb->getExplosionRadius();
-
-                        std::for_each(entities.begin(), entities.end(),
-                            [bombPos, explosionRadius](auto& entity)
-                            {
-                                if (!entity->isAlive()) return;
+                if (!hazard || hazard->getKind() != EntityKind::Bomb)
+                    return;
 
-                                float distance = CollisionDetector::getDistance(
-                                    bombPos, entity->getPosition());
+                const auto* bomb = static_cast<const Bomb*>(hazard.get());
+                const float explosionRadius = bomb->getExplosionRadius();
+                if (!bomb->isExploding() || explosionRadius <= 0.f)
+                    return;
 
-                                if (distance < explosionRadius)
-                                {
-                                    entity->destroy();
-                                }
-                            });
-                    }
-                }
+                const float radiusSq = explosionRadius * explosionRadius;
+                grid.query(bomb->getPosition(), explosionRadius, layers,
+                    [bomb, radiusSq](const SpatialGrid::Proxy& proxy)
+                    {
+                        Entity& target = *proxy.entity;
+                        if (&target == bomb || !target.isAlive() ||
+                            EntityUtils::distanceSquared(*bomb, target) >= radiusSq)
+                            return;
+
+                        if (target.getKind() == EntityKind::Bomb)
+                            static_cast<Bomb&>(target).trigger();
+                        else if (!(proxy.category & CollisionLayer::Hazard))
+                            target.destroy();
+                    });
             });
     }
 }
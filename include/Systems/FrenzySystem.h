@@ -3,6 +3,7 @@
 #include <SFML/Graphics.hpp>
 #include <deque>
 #include "SoundPlayer.h"
+#include "DrawList.h"
 
 namespace FishGame
 {
@@ -13,7 +14,7 @@ namespace FishGame
         SuperFrenzy = 4
     };
 
-    class FrenzySystem : public sf::Drawable
+    class FrenzySystem : public Renderable
     {
     public:
         explicit FrenzySystem(const sf::Font& font);
@@ -41,7 +42,7 @@ namespace FishGame
         void setSoundPlayer(SoundPlayer* player) { m_soundPlayer = player; }
 
     protected:
-        void draw(sf::RenderTarget& target, sf::RenderStates states) const override;
+        void draw(DrawList& target, sf::RenderStates states) const override;
 
     private:
         struct EatEvent
@@ -63,6 +64,7 @@ namespace FishGame
         sf::Text m_frenzyText;
         sf::Text m_multiplierText;
         sf::Text m_timerText;
+        int m_shownTimerTenths{ -1 };
         sf::RectangleShape m_timerBar;
         sf::RectangleShape m_timerBackground;
         sf::Vector2f m_position;
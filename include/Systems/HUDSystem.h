@@ -1,34 +1,63 @@
 #pragma once
 
 #include <SFML/Graphics.hpp>
-#include <unordered_map>
+#include <cstdint>
 #include <string>
 #include "GameConstants.h"
+#include "DrawList.h"
 #include "PowerUp.h"
 
 namespace FishGame
 {
-    class HUDSystem : public sf::Drawable
+    // Values shown by the HUD for one tick
+    struct HUDState
+    {
+        int score = 0;
+        int lives = 0;
+        int level = 0;
+        int chainBonus = 0;
+        std::uint32_t activePowerUps = 0;   // one bit per PowerUpType
+        bool frozen = false;
+        sf::Time freezeTime = sf::Time::Zero;
+        bool reversed = false;
+        sf::Time reverseTime = sf::Time::Zero;
+        bool stunned = false;
+        sf::Time stunTime = sf::Time::Zero;
+    };
+
+    // Retained-mode HUD: each text is rebuilt only when the value it shows
+    // changes, and the composed widgets are cached in a render layer that
+    // is re-recorded only after a change.
+    class HUDSystem : public Renderable
     {
     public:
         HUDSystem(const sf::Font& font, const sf::Vector2u& windowSize);
 
-        void update(int score, int lives, int level, int chainBonus,
-            const std::vector<PowerUpType>& activePowerUps,
-            bool playerFrozen, sf::Time freezeTime,
-            bool reversed, sf::Time reverseTime,
-            bool stunned, sf::Time stunTime,
-            float fps);
+        void update(const HUDState& state);
 
         void showMessage(const std::string& message);
         void clearMessage();
 
     protected:
-        void draw(sf::RenderTarget& target, sf::RenderStates states) const override;
+        void draw(DrawList& target, sf::RenderStates states) const override;
 
     private:
+        // Last values written to the texts; -1 marks "not shown"
+        struct ShownValues
+        {
+            int score = -1;
+            int lives = -1;
+            int level = -1;
+            int chainBonus = -1;
+            std::uint32_t powerUps = 0;
+            int freezeTenths = -1;
+            int reverseTenths = -1;
+            int stunTenths = -1;
+        };
+
         void initText(sf::Text& text, unsigned int size, const sf::Vector2f& pos,
             const sf::Color& color = Constants::HUD_TEXT_COLOR);
+        void drawWidgets(DrawList& target, sf::RenderStates states) const;
 
         sf::Text m_scoreText;
         sf::Text m_livesText;
@@ -38,6 +67,9 @@ namespace FishGame
         sf::Text m_effectsText;
         sf::Text m_messageText;
 
+        ShownValues m_shown;
+        RenderLayer m_layer;
+
         const sf::Font& m_font;
         sf::Vector2u m_windowSize;
     };
@@ -3,6 +3,7 @@
 #include <SFML/Graphics.hpp>
 #include <unordered_map>
 #include "SpriteManager.h"
+#include "DrawList.h"
 
 namespace FishGame
 {
@@ -21,7 +22,7 @@ namespace FishGame
         virtual void registerTailBite(sf::Vector2f position, int frenzyMultiplier,
                                       float powerUpMultiplier) = 0;
         virtual void update(sf::Time deltaTime) = 0;
-        virtual void drawFloatingScores(sf::RenderTarget& target) const = 0;
+        virtual void drawFloatingScores(DrawList& target) const = 0;
         virtual int getCurrentScore() const = 0;
         virtual void setCurrentScore(int score) = 0;
         virtual void recordFish(TextureID id) = 0;
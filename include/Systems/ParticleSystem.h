@@ -4,6 +4,7 @@
 #include <vector>
 #include <random>
 #include "GameConstants.h"
+#include "DrawList.h"
 
 namespace FishGame
 {
@@ -15,7 +16,7 @@ namespace FishGame
         float alpha = 0.f;
     };
 
-    class ParticleSystem : public sf::Drawable
+    class ParticleSystem : public Renderable
     {
     public:
         ParticleSystem();
@@ -24,7 +25,7 @@ namespace FishGame
         void clear() { m_particles.clear(); }
 
     protected:
-        void draw(sf::RenderTarget& target, sf::RenderStates states) const override;
+        void draw(DrawList& target, sf::RenderStates states) const override;
 
     private:
         std::vector<Particle> m_particles;
@@ -1,12 +1,15 @@
 #pragma once
 
 #include <SFML/Graphics.hpp>
-#include <memory>
+#include <array>
 #include <vector>
 #include <cmath>
+#include <string_view>
 #include <unordered_map>
 #include "SpriteManager.h"
 #include "IScoreSystem.h"
+#include "GameConstants.h"
+#include "Utils/FixedString.h"
 
 namespace FishGame
 {
@@ -18,27 +21,35 @@ namespace FishGame
         TailBite
     };
 
-    // Floating score text that appears when points are earned
-    class FloatingScore : public sf::Drawable
+    // Floating score label that appears when points are earned. Instances
+    // live in a fixed pool inside ScoreSystem and are re-armed with spawn();
+    // the label is drawn from cached glyph quads rather than an sf::Text.
+    class FloatingScore
     {
     public:
-        FloatingScore(const sf::Font& font, int points, int multiplier, sf::Vector2f position);
-
+        void spawn(int points, int multiplier, sf::Vector2f position);
         void update(sf::Time deltaTime);
-        bool isExpired() const { return m_lifetime >= m_maxLifetime; }
+        void deactivate() { m_active = false; }
 
-    protected:
-        void draw(sf::RenderTarget& target, sf::RenderStates states) const override;
+        bool isActive() const { return m_active; }
+        std::string_view getLabel() const { return m_label.view(); }
+        sf::Vector2f getPosition() const { return m_position; }
+        sf::Time getLifetime() const { return m_lifetime; }
+        std::size_t getStyle() const { return m_style; }
+        sf::Uint8 getAlpha() const { return static_cast<sf::Uint8>(m_alpha); }
+        float getScale() const { return m_scale; }
 
     private:
-        sf::Text m_text;
-        sf::Vector2f m_velocity;
+        FixedString<24> m_label;
+        sf::Vector2f m_position;
         sf::Time m_lifetime;
-        float m_alpha;
+        float m_alpha{ 0.0f };
+        float m_scale{ 1.0f };
+        std::size_t m_style{ 0 };
+        bool m_active{ false };
 
         static const sf::Time m_maxLifetime;
         static constexpr float m_floatSpeed = -100.0f;
-        static constexpr float m_fadeSpeed = 170.0f;
     };
 
     class ScoreSystem : public IScoreSystem
@@ -69,7 +80,7 @@ namespace FishGame
 
         // Update and rendering
         void update(sf::Time deltaTime) override;
-        void drawFloatingScores(sf::RenderTarget& target) const override;
+        void drawFloatingScores(DrawList& target) const override;
 
         // Score tracking
         int getCurrentScore() const override { return m_currentScore; }
@@ -79,7 +90,21 @@ namespace FishGame
         void reset() override;
 
     private:
+        // Characters a score label can contain
+        static constexpr std::string_view m_glyphChars = "+x 0123456789";
+
+        // Fill and outline glyphs for one label style, looked up on first draw
+        struct GlyphSet
+        {
+            std::array<sf::Glyph, m_glyphChars.size()> fill{};
+            std::array<sf::Glyph, m_glyphChars.size()> outline{};
+            bool loaded = false;
+        };
+
         void createFloatingScore(int points, int multiplier, sf::Vector2f position);
+        const GlyphSet& glyphsFor(std::size_t style) const;
+        void appendLabel(const FloatingScore& score, const GlyphSet& glyphs,
+            std::vector<sf::Vertex>& vertices) const;
 
     private:
         const sf::Font& m_font;
@@ -92,7 +117,9 @@ namespace FishGame
         static constexpr int m_maxChain = 10;
 
         // Visual elements
-        std::vector<std::unique_ptr<FloatingScore>> m_floatingScores;
+        std::array<FloatingScore, Constants::MAX_FLOATING_SCORES> m_floatingScores;
+        mutable std::array<GlyphSet, 3> m_glyphs;
+        mutable std::array<std::vector<sf::Vertex>, 3> m_vertices;   // reused per draw
 
         // Fish counts
         std::unordered_map<TextureID,int> m_fishCounts;
@@ -0,0 +1,151 @@
+#pragma once
+
+#include "Entity.h"
+#include "CollisionFilter.h"
+#include "CircleBatch.h"
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+
+namespace FishGame
+{
+    // Uniform grid rebuilt every tick. Proxies are bucketed with a counting
+    // sort into flat arrays, so steady-state rebuilds do not allocate.
+    // Positions outside the bounds clamp to the border cells.
+    class SpatialGrid
+    {
+    public:
+        struct Proxy
+        {
+            Entity* entity;
+            sf::Vector2f position;
+            float radius;
+            LayerMask category;
+            LayerMask mask;
+            std::uint32_t group;   // caller-defined container id
+            std::uint32_t index;   // slot inside that container
+            bool conservative;     // bounds enclose more than the live circle
+        };
+
+        SpatialGrid(const sf::FloatRect& bounds, float cellSize);
+
+        void clear() { m_proxies.clear(); }
+        void add(Entity& entity, std::uint32_t group, std::uint32_t index);
+        // Inserts an explicit bounding circle, e.g. the full sweep of a moving
+        // or bobbing item; hits on it need a narrow-phase check
+        void add(Entity& entity, const sf::Vector2f& center, float radius,
+                 std::uint32_t group, std::uint32_t index);
+        void build();
+
+        const std::vector<Proxy>& proxies() const noexcept { return m_proxies; }
+        bool empty() const noexcept { return m_proxies.empty(); }
+
+        // Visits every proxy on a layer in `layers` whose circle overlaps
+        // the query circle, each exactly once
+        template<typename Func>
+        void query(const sf::Vector2f& center, float radius, LayerMask layers, Func&& func) const
+        {
+            const CellRange range = cellRange(center, radius);
+            for (int y = range.minY; y <= range.maxY; ++y)
+            {
+                for (int x = range.minX; x <= range.maxX; ++x)
+                {
+                    const std::size_t cell = cellIndex(x, y);
+                    const std::uint32_t begin = m_cellStart[cell];
+
+                    // Distance test runs batched over the cell's packed circles
+                    CircleBatch::forEachOverlap(center.x, center.y, radius,
+                        m_packedX.data() + begin, m_packedY.data() + begin, m_packedRadius.data() + begin,
+                        m_cellStart[cell + 1] - begin,
+                        [&](std::size_t offset)
+                        {
+                            const Proxy& proxy = m_proxies[m_cellItems[begin + offset]];
+                            if ((proxy.category & layers) == 0)
+                                return;
+
+                            // Report only from the first cell both boxes share
+                            const CellRange other = cellRange(proxy.position, proxy.radius);
+                            if (std::max(range.minX, other.minX) != x || std::max(range.minY, other.minY) != y)
+                                return;
+
+                            func(proxy);
+                        });
+                }
+            }
+        }
+
+        // Visits each overlapping pair the filter accepts exactly once;
+        // rejected layer pairs never reach the distance test
+        template<typename Func>
+        void forEachPair(const CollisionFilter& filter, Func&& func) const
+        {
+            for (std::size_t cell = 0; cell + 1 < m_cellStart.size(); ++cell)
+            {
+                const std::uint32_t begin = m_cellStart[cell];
+                const std::uint32_t end = m_cellStart[cell + 1];
+                const int cx = static_cast<int>(cell % m_columns);
+                const int cy = static_cast<int>(cell / m_columns);
+
+                for (std::uint32_t i = begin; i < end; ++i)
+                {
+                    const Proxy& a = m_proxies[m_cellItems[i]];
+                    const LayerMask acceptsA = filter.maskFor(a.category) & a.mask;
+                    const CellRange rangeA = cellRange(a.position, a.radius);
+
+                    for (std::uint32_t j = i + 1; j < end; ++j)
+                    {
+                        const Proxy& b = m_proxies[m_cellItems[j]];
+                        if ((acceptsA & b.category) == 0 || (b.mask & a.category) == 0)
+                            continue;
+
+                        const CellRange rangeB = cellRange(b.position, b.radius);
+                        if (std::max(rangeA.minX, rangeB.minX) != cx || std::max(rangeA.minY, rangeB.minY) != cy)
+                            continue;
+
+                        if (overlaps(a.position, a.radius, b.position, b.radius))
+                            func(a, b);
+                    }
+                }
+            }
+        }
+
+    private:
+        struct CellRange
+        {
+            int minX, minY, maxX, maxY;
+        };
+
+        static bool overlaps(const sf::Vector2f& pa, float ra, const sf::Vector2f& pb, float rb) noexcept
+        {
+            const sf::Vector2f diff = pa - pb;
+            const float radiusSum = ra + rb;
+            return diff.x * diff.x + diff.y * diff.y < radiusSum * radiusSum;
+        }
+
+        int clampColumn(float x) const noexcept;
+        int clampRow(float y) const noexcept;
+        CellRange cellRange(const sf::Vector2f& center, float radius) const noexcept;
+        std::size_t cellIndex(int x, int y) const noexcept
+        {
+            return static_cast<std::size_t>(y) * m_columns + static_cast<std::size_t>(x);
+        }
+
+        sf::FloatRect m_bounds;
+        float m_inverseCellSize;
+        std::size_t m_columns;
+        std::size_t m_rows;
+
+        std::vector<Proxy> m_proxies;
+        std::vector<std::uint32_t> m_cellStart;   // prefix sums, one past each cell
+        std::vector<std::uint32_t> m_cellItems;   // proxy indices grouped by cell
+        std::vector<std::uint32_t> m_cursor;
+
+        // Proxy circles in m_cellItems order, for the batched overlap kernel.
+        // Entities keep their positions inline, so there is no movement-side
+        // SoA to read; cell order also keeps each cell's span contiguous, so
+        // the kernel does plain vector loads instead of gathers
+        std::vector<float> m_packedX;
+        std::vector<float> m_packedY;
+        std::vector<float> m_packedRadius;
+    };
+}
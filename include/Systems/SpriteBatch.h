@@ -0,0 +1,55 @@
+#pragma once
+
+#include <SFML/Graphics.hpp>
+#include <vector>
+#include "DrawList.h"
+
+namespace FishGame
+{
+    // Collects textured quads into one vertex array per (layer, texture) and
+    // submits each array with a single draw call. Renderables that cannot be
+    // expressed as quads are deferred and drawn after the quads, in order.
+    class SpriteBatch
+    {
+    public:
+        void clear();
+
+        // Appends the sprite's quad exactly as sf::Sprite would draw it
+        void add(const sf::Sprite& sprite, int layer = 0);
+        void add(const sf::Texture& texture, const sf::IntRect& textureRect,
+                 const sf::Transform& transform, const sf::Color& color, int layer = 0);
+
+        void defer(const Renderable& drawable) { m_deferred.push_back({ &drawable, m_offset }); }
+
+        // Translation applied to everything added or deferred until changed;
+        // used to draw entities at their interpolated positions
+        void setOffset(sf::Vector2f offset) noexcept { m_offset = offset; }
+
+        void draw(DrawList& target, sf::RenderStates states = sf::RenderStates::Default) const;
+
+        std::size_t getBatchCount() const noexcept { return m_batches.size(); }
+
+    private:
+        struct Batch
+        {
+            int layer;
+            const sf::Texture* texture;
+            sf::VertexArray vertices;
+        };
+
+        Batch& batchFor(const sf::Texture& texture, int layer);
+
+        // Kept between frames so steady-state batching does not allocate
+        std::vector<Batch> m_batches;
+        std::size_t m_activeBatches{ 0 };
+        struct Deferred
+        {
+            const Renderable* drawable;
+            sf::Vector2f offset;
+        };
+
+        std::vector<Deferred> m_deferred;
+        sf::Vector2f m_offset{};
+        mutable std::vector<const Batch*> m_order;
+    };
+}
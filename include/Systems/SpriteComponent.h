@@ -5,6 +5,7 @@
 #include <unordered_map>
 #include <string>
 #include <optional>
+#include "DrawList.h"
 
 namespace FishGame
 {
@@ -25,7 +26,7 @@ namespace FishGame
 
     // Template-based sprite component
     template<typename OwnerType>
-    class SpriteComponent : public sf::Drawable
+    class SpriteComponent : public Renderable
     {
     public:
         explicit SpriteComponent(OwnerType* owner);
@@ -33,6 +34,7 @@ namespace FishGame
 
         // Initialization
         void setTexture(const sf::Texture& texture);
+        void setTexture(const sf::Texture& texture, const sf::IntRect& region);
         void configure(const SpriteConfig<OwnerType>& config);
 
         // Update and positioning
@@ -52,7 +54,7 @@ namespace FishGame
         void applyPulseEffect(float scale, float speed);
 
     protected:
-        void draw(sf::RenderTarget& target, sf::RenderStates states) const override;
+        void draw(DrawList& target, sf::RenderStates states) const override;
 
     private:
         OwnerType* m_owner;
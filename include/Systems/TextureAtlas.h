@@ -0,0 +1,61 @@
+#pragma once
+
+#include <SFML/Graphics.hpp>
+#include <memory>
+#include <vector>
+
+namespace FishGame
+{
+    // Packs many images into a few large textures at load time so sprites
+    // from different sheets share a texture and can be batched together.
+    // Uses a skyline bottom-left packer; images larger than a page get a
+    // page of their own.
+    class TextureAtlas
+    {
+    public:
+        struct Region
+        {
+            std::size_t page;
+            sf::IntRect rect;
+        };
+
+        explicit TextureAtlas(unsigned int pageSize = 4096, unsigned int padding = 2);
+
+        // Queues an image and returns the handle used to look up its region
+        std::size_t add(sf::Image image);
+
+        // Packs every queued image and uploads the pages; queued pixels are
+        // released afterwards
+        void build();
+
+        const Region& getRegion(std::size_t handle) const { return m_regions[handle]; }
+        const sf::Texture& getPage(std::size_t page) const { return *m_pages[page]; }
+        std::size_t getPageCount() const noexcept { return m_pages.size(); }
+
+    private:
+        struct SkylineNode
+        {
+            int x;
+            int y;
+            int width;
+        };
+
+        struct PageLayout
+        {
+            int width;
+            int height;
+            std::vector<SkylineNode> skyline;
+            int usedWidth{ 0 };
+            int usedHeight{ 0 };
+        };
+
+        static bool findPosition(const PageLayout& page, int width, int height, sf::Vector2i& position);
+        static void place(PageLayout& page, const sf::IntRect& rect);
+
+        unsigned int m_pageSize;
+        unsigned int m_padding;
+        std::vector<sf::Image> m_images;
+        std::vector<Region> m_regions;
+        std::vector<std::unique_ptr<sf::Texture>> m_pages;
+    };
+}
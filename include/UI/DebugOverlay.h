@@ -0,0 +1,42 @@
+#pragma once
+
+#include <SFML/Graphics.hpp>
+#include "FramePacer.h"
+
+namespace FishGame
+{
+    // Frame timing readout drawn over every state; toggled with F3
+    class DebugOverlay : public sf::Drawable
+    {
+    public:
+        struct Readout
+        {
+            float fps = 0.0f;
+            unsigned int tickRate = 0;
+            PacingMode pacing = PacingMode::Limiter;
+            sf::Time p50 = sf::Time::Zero;
+            sf::Time p95 = sf::Time::Zero;
+            sf::Time p99 = sf::Time::Zero;
+            sf::Time worst = sf::Time::Zero;
+            sf::Time droppedTime = sf::Time::Zero;
+            float timeScale = 1.0f;
+            sf::Time inputLatency = sf::Time::Zero;
+            std::size_t lazyGlyphLoads = 0;   // font pages grown after warm-up
+        };
+
+        explicit DebugOverlay(const sf::Font& font);
+
+        void update(const Readout& readout);
+
+        void toggle() noexcept { m_visible = !m_visible; }
+        bool isVisible() const noexcept { return m_visible; }
+
+    protected:
+        void draw(sf::RenderTarget& target, sf::RenderStates states) const override;
+
+    private:
+        sf::RectangleShape m_background;
+        sf::Text m_text;
+        bool m_visible{ false };
+    };
+}
@@ -2,10 +2,11 @@
 
 #include <SFML/Graphics.hpp>
 #include <functional>
+#include "DrawList.h"
 
 namespace FishGame
 {
-    class GrowthMeter : public sf::Drawable
+    class GrowthMeter : public Renderable
     {
     public:
         explicit GrowthMeter(const sf::Font& font);
@@ -30,10 +31,12 @@ namespace FishGame
         void setOnStageComplete(std::function<void()> callback) { m_onStageComplete = callback; }
 
     protected:
-        void draw(sf::RenderTarget& target, sf::RenderStates states) const override;
+        void draw(DrawList& target, sf::RenderStates states) const override;
 
     private:
-        void updateVisuals();
+        void updateFill();
+        void updateProgressText();
+        int getTargetPoints() const;
 
     private:
         // Visual components
@@ -51,6 +54,8 @@ namespace FishGame
 
         // Points tracking
         int m_points;
+        int m_shownPoints{ -1 };
+        int m_shownTarget{ -1 };
 
         // Animation
         float m_targetProgress;
@@ -4,8 +4,9 @@
 #include <unordered_map>
 #include <vector>
 #include <string>
+#include "DrawList.h"
 
-class AnimatedSprite : public sf::Drawable
+class AnimatedSprite : public FishGame::Renderable
 {
 public:
     struct Animation
@@ -15,7 +16,8 @@ public:
         bool loop{true};
     };
 
-    explicit AnimatedSprite(const sf::Texture& texture);
+    // Animation frames are shifted by frameOffset, the sheet's atlas position
+    explicit AnimatedSprite(const sf::Texture& texture, sf::Vector2i frameOffset = {});
 
     void addAnimation(const std::string& name, const Animation& anim);
     void play(const std::string& name);
@@ -26,14 +28,16 @@ public:
     void setScale(const sf::Vector2f& scale) { m_sprite.setScale(scale); }
     void setRotation(float angle) { m_sprite.setRotation(angle); }
     float getRotation() const { return m_sprite.getRotation(); }
+    const sf::Sprite& getSprite() const { return m_sprite; }
 
     bool isFinished() const { return m_finished; }
 
 private:
-    void draw(sf::RenderTarget& target, sf::RenderStates states) const override;
+    void draw(FishGame::DrawList& target, sf::RenderStates states) const override;
 
     const sf::Texture& m_texture;
     sf::Sprite m_sprite;
+    sf::Vector2i m_frameOffset;
     std::unordered_map<std::string, Animation> m_anims;
     const Animation* m_current{nullptr};
     std::size_t m_index{0};
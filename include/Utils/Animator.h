@@ -4,11 +4,15 @@
 #include <unordered_map>
 #include <string>
 #include <vector>
+#include "DrawList.h"
 
-class Animator : public sf::Drawable
+class Animator : public FishGame::Renderable
 {
 public:
-    Animator(const sf::Texture& texture, int frameWidth, int frameHeight, int startX = 1);
+    // Frame rects are given relative to the sheet and shifted by frameOffset,
+    // the sheet's position inside an atlas page
+    Animator(const sf::Texture& texture, int frameWidth, int frameHeight, int startX = 1,
+        sf::Vector2i frameOffset = {});
 
     void addClip(const std::string& name, const std::vector<sf::IntRect>& frames,
         sf::Time frameTime, bool loop = true, bool flipped = false,
@@ -26,6 +30,7 @@ public:
     void setScale(const sf::Vector2f& scale);
     sf::Vector2f getScale() const { return m_scale; }
     void setColor(const sf::Color& color) { m_sprite.setColor(color); }
+    const sf::Sprite& getSprite() const { return m_sprite; }
 
 private:
     struct Clip
@@ -37,7 +42,7 @@ private:
         bool pingPong{ false };
     };
 
-    void draw(sf::RenderTarget& target, sf::RenderStates states) const override;
+    void draw(FishGame::DrawList& target, sf::RenderStates states) const override;
     void applyScale();
 
     const sf::Texture& m_texture;
@@ -45,6 +50,7 @@ private:
     int m_startX;
     int m_frameW;
     int m_frameH;
+    sf::Vector2i m_frameOffset;
     sf::Vector2f m_scale{ 1.f, 1.f };
     std::unordered_map<std::string, Clip> m_clips;
     const Clip* m_current{ nullptr };
@@ -55,9 +61,9 @@ private:
 };
 
 // Helper factory functions
-Animator createFishAnimator(const sf::Texture& texture);
-Animator createBarracudaAnimator(const sf::Texture& texture);
-Animator createSimpleFishAnimator(const sf::Texture& texture);
-Animator createMediumFishAnimator(const sf::Texture& texture);
-Animator createPufferfishAnimator(const sf::Texture& texture);
-Animator createLargeFishAnimator(const sf::Texture& texture);
+Animator createFishAnimator(const sf::Texture& texture, sf::Vector2i frameOffset = {});
+Animator createBarracudaAnimator(const sf::Texture& texture, sf::Vector2i frameOffset = {});
+Animator createSimpleFishAnimator(const sf::Texture& texture, sf::Vector2i frameOffset = {});
+Animator createMediumFishAnimator(const sf::Texture& texture, sf::Vector2i frameOffset = {});
+Animator createPufferfishAnimator(const sf::Texture& texture, sf::Vector2i frameOffset = {});
+Animator createLargeFishAnimator(const sf::Texture& texture, sf::Vector2i frameOffset = {});
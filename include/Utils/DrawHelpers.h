@@ -2,10 +2,19 @@
 
 #include <SFML/Graphics.hpp>
 #include <algorithm>
+#include "DrawList.h"
 
 namespace FishGame::DrawUtils {
+    // World-space rectangle shown by an unrotated view, grown by margin
+    inline sf::FloatRect visibleArea(const sf::View& view, float margin = 0.f)
+    {
+        const sf::Vector2f half = view.getSize() * 0.5f + sf::Vector2f(margin, margin);
+        const sf::Vector2f center = view.getCenter();
+        return { center.x - half.x, center.y - half.y, half.x * 2.f, half.y * 2.f };
+    }
+
     template<typename Container>
-    void drawContainer(const Container& container, sf::RenderTarget& target,
+    void drawContainer(const Container& container, DrawList& target,
         sf::RenderStates states = {})
     {
         std::for_each(container.begin(), container.end(),
@@ -0,0 +1,69 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <charconv>
+#include <cstddef>
+#include <string_view>
+
+namespace FishGame
+{
+    // Small fixed-capacity text buffer for HUD strings: formats numbers with
+    // std::to_chars so composing a label never touches the heap. Output
+    // beyond the capacity is dropped.
+    template<std::size_t Capacity>
+    class FixedString
+    {
+    public:
+        FixedString() { m_data[0] = '\0'; }
+
+        void clear() noexcept
+        {
+            m_size = 0;
+            m_data[0] = '\0';
+        }
+
+        FixedString& operator<<(std::string_view text) noexcept
+        {
+            const std::size_t count = std::min(text.size(), Capacity - m_size);
+            std::copy_n(text.data(), count, m_data.data() + m_size);
+            m_size += count;
+            m_data[m_size] = '\0';
+            return *this;
+        }
+
+        FixedString& operator<<(char c) noexcept
+        {
+            return *this << std::string_view(&c, 1);
+        }
+
+        FixedString& operator<<(int value) noexcept
+        {
+            char* end = m_data.data() + Capacity;
+            auto [ptr, ec] = std::to_chars(m_data.data() + m_size, end, value);
+            if (ec == std::errc())
+                m_size = static_cast<std::size_t>(ptr - m_data.data());
+            m_data[m_size] = '\0';
+            return *this;
+        }
+
+        // Writes tenths as "<whole>.<tenth>", e.g. 37 -> "3.7"
+        FixedString& appendTenths(int tenths) noexcept
+        {
+            if (tenths < 0)
+            {
+                *this << '-';
+                tenths = -tenths;
+            }
+            return *this << tenths / 10 << '.' << tenths % 10;
+        }
+
+        const char* c_str() const noexcept { return m_data.data(); }
+        std::string_view view() const noexcept { return { m_data.data(), m_size }; }
+        bool empty() const noexcept { return m_size == 0; }
+
+    private:
+        std::array<char, Capacity + 1> m_data{};
+        std::size_t m_size{ 0 };
+    };
+}
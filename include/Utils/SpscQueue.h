@@ -0,0 +1,49 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <optional>
+#include <type_traits>
+
+namespace FishGame
+{
+    // Bounded lock-free queue for one producer thread and one consumer
+    // thread. Capacity must be a power of two; push() fails when full.
+    template<typename T, std::size_t Capacity>
+    class SpscQueue
+    {
+        static_assert((Capacity & (Capacity - 1)) == 0, "Capacity must be a power of two");
+        static_assert(std::is_trivially_copyable_v<T>, "T is copied in and out of the ring");
+
+    public:
+        bool push(const T& value) noexcept
+        {
+            const std::size_t tail = m_tail.load(std::memory_order_relaxed);
+            if (tail - m_head.load(std::memory_order_acquire) == Capacity)
+                return false;
+
+            m_slots[tail & (Capacity - 1)] = value;
+            m_tail.store(tail + 1, std::memory_order_release);
+            return true;
+        }
+
+        std::optional<T> pop() noexcept
+        {
+            const std::size_t head = m_head.load(std::memory_order_relaxed);
+            if (head == m_tail.load(std::memory_order_acquire))
+                return std::nullopt;
+
+            T value = m_slots[head & (Capacity - 1)];
+            m_head.store(head + 1, std::memory_order_release);
+            return value;
+        }
+
+    private:
+        std::array<T, Capacity> m_slots{};
+
+        // Kept on separate cache lines so the two threads do not contend
+        alignas(64) std::atomic<std::size_t> m_head{ 0 };
+        alignas(64) std::atomic<std::size_t> m_tail{ 0 };
+    };
+}
@@ -0,0 +1,62 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+
+namespace FishGame
+{
+    // Lock-free single-producer, single-consumer mailbox. The producer fills
+    // its back slot and publishes it; the consumer takes the newest
+    // published slot. Three slots mean neither side ever waits on the other
+    // to finish with a slot, and a value the consumer never took is simply
+    // overwritten by the next one.
+    template<typename T>
+    class TripleBuffer
+    {
+    public:
+        // Producer side
+        T& back() noexcept { return m_slots[m_back]; }
+
+        void publish() noexcept
+        {
+            const std::uint8_t published = static_cast<std::uint8_t>(m_back | freshBit);
+            m_back = static_cast<std::uint8_t>(m_middle.exchange(published) & indexMask);
+        }
+
+        // Blocks while the last published value has not been taken. To stop
+        // the producer, set stop and then call acquire() once.
+        void waitUntilTaken(const std::atomic<bool>& stop) const noexcept
+        {
+            std::uint8_t middle = m_middle.load();
+            while ((middle & freshBit) && !stop.load())
+            {
+                m_middle.wait(middle);
+                middle = m_middle.load();
+            }
+        }
+
+        // Consumer side: swaps in the newest value if one was published
+        // since the last call and reports whether it did
+        bool acquire() noexcept
+        {
+            if (!(m_middle.load() & freshBit))
+                return false;
+
+            m_front = static_cast<std::uint8_t>(m_middle.exchange(m_front) & indexMask);
+            m_middle.notify_one();
+            return true;
+        }
+
+        const T& front() const noexcept { return m_slots[m_front]; }
+
+    private:
+        static constexpr std::uint8_t indexMask = 0x3;
+        static constexpr std::uint8_t freshBit = 0x4;
+
+        std::array<T, 3> m_slots{};
+        std::uint8_t m_back{ 0 };
+        std::atomic<std::uint8_t> m_middle{ 1 };
+        std::uint8_t m_front{ 2 };
+    };
+}
@@ -0,0 +1,173 @@
+#include "DrawList.h"
+#include <type_traits>
+
+namespace FishGame
+{
+    struct RenderLayer::Cache
+    {
+        enum class State { Pending, Ready, Unavailable };
+
+        // Created on first replay, once the render thread's context is active
+        sf::RenderTexture texture;
+        State state{ State::Pending };
+        std::shared_ptr<const DrawList> drawn;
+    };
+
+    RenderLayer::RenderLayer(const sf::Color& clearColor, const sf::BlendMode& blitMode)
+        : m_cache(std::make_shared<Cache>())
+        , m_clearColor(clearColor)
+        , m_blitMode(blitMode)
+    {
+    }
+
+    DrawList& RenderLayer::record(sf::Vector2u size, bool smooth)
+    {
+        m_content = std::make_shared<DrawList>(size);
+        m_smooth = smooth;
+        return *m_content;
+    }
+
+    DrawList::DrawList(sf::Vector2u size)
+    {
+        reset(size);
+    }
+
+    void DrawList::reset(sf::Vector2u size)
+    {
+        m_commands.clear();
+        m_vertices.clear();
+        m_size = size;
+        m_defaultView.reset(sf::FloatRect(0.f, 0.f, static_cast<float>(size.x), static_cast<float>(size.y)));
+        m_view = m_defaultView;
+    }
+
+    void DrawList::draw(const Renderable& renderable, const sf::RenderStates& states)
+    {
+        renderable.draw(*this, states);
+    }
+
+    void DrawList::draw(const sf::Sprite& sprite, const sf::RenderStates& states)
+    {
+        m_commands.push_back({ sprite, states });
+    }
+
+    void DrawList::draw(const sf::Text& text, const sf::RenderStates& states)
+    {
+        // Lays the glyphs out here, so replaying the copy only reads the font
+        text.getLocalBounds();
+        m_commands.push_back({ text, states });
+    }
+
+    void DrawList::draw(const sf::RectangleShape& shape, const sf::RenderStates& states)
+    {
+        m_commands.push_back({ shape, states });
+    }
+
+    void DrawList::draw(const sf::CircleShape& shape, const sf::RenderStates& states)
+    {
+        m_commands.push_back({ shape, states });
+    }
+
+    void DrawList::draw(const sf::ConvexShape& shape, const sf::RenderStates& states)
+    {
+        m_commands.push_back({ shape, states });
+    }
+
+    void DrawList::draw(const sf::VertexArray& vertices, const sf::RenderStates& states)
+    {
+        if (vertices.getVertexCount() > 0)
+            draw(&vertices[0], vertices.getVertexCount(), vertices.getPrimitiveType(), states);
+    }
+
+    void DrawList::draw(const sf::Vertex* vertices, std::size_t vertexCount, sf::PrimitiveType type,
+                        const sf::RenderStates& states)
+    {
+        if (!vertices || vertexCount == 0)
+            return;
+
+        const std::size_t first = m_vertices.size();
+        m_vertices.insert(m_vertices.end(), vertices, vertices + vertexCount);
+        m_commands.push_back({ VertexRange{ first, vertexCount, type }, states });
+    }
+
+    void DrawList::draw(const RenderLayer& layer, sf::Vector2f size, const sf::RenderStates& states)
+    {
+        if (!layer.m_content)
+            return;
+
+        m_commands.push_back({ LayerBlit{ layer.m_cache, layer.m_content, size,
+            layer.m_clearColor, layer.m_blitMode, layer.m_smooth }, states });
+    }
+
+    void DrawList::setView(const sf::View& view)
+    {
+        m_view = view;
+        m_commands.push_back({ view, sf::RenderStates::Default });
+    }
+
+    void DrawList::replay(sf::RenderTarget& target, const sf::RenderStates& base) const
+    {
+        for (const Command& command : m_commands)
+        {
+            sf::RenderStates states = command.states;
+            states.transform = base.transform * states.transform;
+
+            std::visit([this, &target, &states](const auto& primitive)
+                {
+                    using Type = std::decay_t<decltype(primitive)>;
+                    if constexpr (std::is_same_v<Type, sf::View>)
+                        target.setView(primitive);
+                    else if constexpr (std::is_same_v<Type, VertexRange>)
+                        target.draw(m_vertices.data() + primitive.first, primitive.count, primitive.type, states);
+                    else if constexpr (std::is_same_v<Type, LayerBlit>)
+                        replayLayer(primitive, target, states);
+                    else
+                        target.draw(primitive, states);
+                }, command.primitive);
+        }
+    }
+
+    void DrawList::replayLayer(const LayerBlit& blit, sf::RenderTarget& target, sf::RenderStates states)
+    {
+        using State = RenderLayer::Cache::State;
+
+        RenderLayer::Cache& cache = *blit.cache;
+        const sf::Vector2u size = blit.content->getSize();
+        if (size.x == 0 || size.y == 0)
+            return;
+
+        // Content recorded at a new size needs a new texture
+        if (cache.state == State::Ready && cache.texture.getSize() != size)
+            cache.state = State::Pending;
+
+        if (cache.state == State::Pending)
+        {
+            cache.drawn.reset();
+            cache.state = cache.texture.create(size.x, size.y) ? State::Ready : State::Unavailable;
+        }
+
+        const sf::Vector2f scale(blit.area.x / static_cast<float>(size.x), blit.area.y / static_cast<float>(size.y));
+
+        if (cache.state != State::Ready)
+        {
+            // No offscreen texture: draw the content straight onto the target
+            states.transform.scale(scale);
+            blit.content->replay(target, states);
+            return;
+        }
+
+        if (cache.drawn != blit.content)
+        {
+            cache.texture.setSmooth(blit.smooth);
+            cache.texture.clear(blit.clearColor);
+            blit.content->replay(cache.texture);
+            cache.texture.display();
+            cache.drawn = blit.content;
+        }
+
+        sf::Sprite sprite(cache.texture.getTexture());
+        sprite.setScale(scale);
+        states.blendMode = blit.blitMode;
+        target.draw(sprite, states);
+    }
+}
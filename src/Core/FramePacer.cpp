@@ -0,0 +1,48 @@
+#include "FramePacer.h"
+#include "GameConstants.h"
+#include <algorithm>
+#include <thread>
+
+namespace FishGame
+{
+    FramePacer::FramePacer(unsigned int targetRate)
+    {
+        setTargetRate(targetRate);
+    }
+
+    void FramePacer::setTargetRate(unsigned int targetRate)
+    {
+        m_targetRate = std::max(1u, targetRate);
+        m_interval = std::chrono::duration_cast<Clock::duration>(
+            std::chrono::duration<double>(1.0 / static_cast<double>(m_targetRate)));
+    }
+
+    void FramePacer::waitForNextFrame()
+    {
+        if (m_mode != PacingMode::Limiter)
+            return;
+
+        const Clock::time_point now = Clock::now();
+        if (now >= m_deadline)
+        {
+            // First frame or a missed deadline: restart the cadence from now
+            // rather than rushing out back-to-back frames to catch up
+            m_deadline = now + m_interval;
+            return;
+        }
+
+        const auto spinMargin = std::chrono::duration_cast<Clock::duration>(
+            std::chrono::duration<float, std::milli>(Constants::FRAME_PACER_SPIN_MS));
+        if (m_deadline - now > spinMargin)
+        {
+            std::this_thread::sleep_for(m_deadline - now - spinMargin);
+        }
+
+        while (Clock::now() < m_deadline)
+        {
+            std::this_thread::yield();
+        }
+
+        m_deadline += m_interval;
+    }
+}
@@ -0,0 +1,51 @@
+#include "FrameTimeHistogram.h"
+#include <algorithm>
+#include <cmath>
+
+namespace FishGame
+{
+    namespace
+    {
+        const sf::Time bucketWidth = sf::microseconds(
+            static_cast<sf::Int64>(Constants::FRAME_HISTOGRAM_BUCKET_MS * 1000.0f));
+    }
+
+    void FrameTimeHistogram::record(sf::Time frameTime)
+    {
+        const auto bucket = static_cast<std::size_t>(
+            std::max<sf::Int64>(0, frameTime.asMicroseconds() / bucketWidth.asMicroseconds()));
+        ++m_buckets[std::min(bucket, m_buckets.size() - 1)];
+        ++m_count;
+        m_max = std::max(m_max, frameTime);
+    }
+
+    void FrameTimeHistogram::clear()
+    {
+        m_buckets.fill(0);
+        m_count = 0;
+        m_max = sf::Time::Zero;
+    }
+
+    sf::Time FrameTimeHistogram::percentile(float fraction) const
+    {
+        if (m_count == 0)
+            return sf::Time::Zero;
+
+        const auto target = std::max<std::size_t>(1,
+            static_cast<std::size_t>(std::ceil(static_cast<double>(fraction) * static_cast<double>(m_count))));
+
+        std::size_t seen = 0;
+        for (std::size_t i = 0; i < m_buckets.size(); ++i)
+        {
+            seen += m_buckets[i];
+            if (seen >= target)
+            {
+                // The overflow bucket has no upper edge; report the worst frame
+                if (i + 1 == m_buckets.size())
+                    return m_max;
+                return bucketWidth * static_cast<sf::Int64>(i + 1);
+            }
+        }
+        return m_max;
+    }
+}
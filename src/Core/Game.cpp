@@ -8,13 +8,12 @@
 #include "GameOptionsState.h"
 #include "StageIntroState.h"
 #include "StageSummaryState.h"
+#include <algorithm>
+#include <cmath>
 
 namespace FishGame
 {
-    // Static member initialization using GameConstants
-    const sf::Time Game::m_timePerFrame = sf::seconds(1.0f / Constants::FRAMERATE_LIMIT);
-
-    Game::Game()
+    Game::Game(unsigned int tickRate)
         : m_window(sf::VideoMode(m_windowWidth, m_windowHeight),
             Constants::GAME_TITLE,
             sf::Style::Close)
@@ -26,10 +25,13 @@ namespace FishGame
         , m_soundPlayer(std::make_unique<SoundPlayer>())
         , m_metrics()
     {
-        m_window.setFramerateLimit(m_frameRateLimit);
+        setTickRate(tickRate);
 
         // Load resources
         m_fonts.load(Fonts::Main, "Regular.ttf");
+        m_debugOverlay = std::make_unique<DebugOverlay>(m_fonts.get(Fonts::Main));
+        m_glyphWarmer = std::make_unique<GlyphWarmer>(m_fonts.get(Fonts::Main));
+        m_inputLatch.resync(InputLatch::queryKeys());
 
         initializeGraphics();
 
@@ -37,45 +39,142 @@ namespace FishGame
         pushState(StateID::Intro);
     }
 
+    Game::~Game()
+    {
+        stopSimulation();
+    }
+
     void Game::run()
     {
-        sf::Clock clock;
-        sf::Time timeSinceLastUpdate = sf::Time::Zero;
+        m_simulation = std::thread([this]() { simulate(); });
 
-        while (m_window.isOpen())
+        try
         {
-            const sf::Time deltaTime = clock.restart();
-            timeSinceLastUpdate += deltaTime;
+            sf::Clock clock;
+            while (m_window.isOpen())
+            {
+                recordFrameTime(clock.restart());
+                processInput();
 
-            // Update performance metrics
-            m_metrics.accumulatedTime += deltaTime;
-            ++m_metrics.frameCount;
+                // The simulation ends when the state stack empties or a tick throws
+                if (m_simulationDone)
+                {
+                    m_window.close();
+                    break;
+                }
 
-            if (m_metrics.accumulatedTime >= sf::seconds(1.0f))
-            {
-                m_metrics.currentFPS = static_cast<float>(m_metrics.frameCount) /
-                    m_metrics.accumulatedTime.asSeconds();
-                m_metrics.frameCount = 0;
-                m_metrics.accumulatedTime = sf::Time::Zero;
+                // Taking a snapshot lets the simulation start on the next
+                // frame while this one is drawn; without a new one the last
+                // frame is shown again
+                const bool newFrame = m_frames.acquire();
+                render();
+                m_window.display();
+
+                // The first frame simulated with this input is now on screen
+                const RenderSnapshot& frame = m_frames.front();
+                if (newFrame && frame.latchedInput)
+                    recordInputLatency(*frame.latchedInput);
+
+                m_pacer.waitForNextFrame();
             }
+        }
+        catch (...)
+        {
+            stopSimulation();
+            throw;
+        }
+
+        stopSimulation();
+        if (m_simulationError)
+            std::rethrow_exception(m_simulationError);
+    }
+
+    void Game::stopSimulation() noexcept
+    {
+        if (!m_simulation.joinable())
+            return;
 
-            // Fixed timestep with interpolation
-            while (timeSinceLastUpdate > m_timePerFrame)
+        // Taking the pending snapshot wakes a simulation waiting to publish
+        m_stopSimulation = true;
+        m_frames.acquire();
+        m_simulation.join();
+    }
+
+    void Game::simulate()
+    {
+        try
+        {
+            sf::Clock clock;
+            sf::Time timeSinceLastUpdate = sf::Time::Zero;
+
+            while (!m_stopSimulation)
             {
-                timeSinceLastUpdate -= m_timePerFrame;
+                sf::Time deltaTime = clock.restart();
 
-                processInput();
-                update(m_timePerFrame);
+                // A hitch (loading, window drag) must not turn into a burst of ticks
+                const sf::Time maxFrameTime = sf::seconds(Constants::MAX_FRAME_TIME);
+                if (deltaTime > maxFrameTime)
+                {
+                    m_simulationStats.droppedTime += deltaTime - maxFrameTime;
+                    ++m_simulationStats.clampedFrames;
+                    deltaTime = maxFrameTime;
+                }
+
+                const sf::Time scaledTime = deltaTime * m_simulationStats.timeScale;
+                m_simulationStats.dilatedTime += deltaTime - scaledTime;
+                timeSinceLastUpdate += scaledTime;
+
+                // Events queued by the main thread are handled once per frame;
+                // the snapshot is latched right before the first tick that
+                // uses it, so a frame that runs no ticks leaves the pending
+                // input for the next one
+                drainInput();
+                std::optional<InputLatch::Clock::time_point> latchedInput;
 
-                // Check if we need to close
-                if (m_stateManager.empty())
+                // Fixed timestep; the recorded frame blends the last two ticks by the remainder
+                unsigned int ticks = 0;
+                while (timeSinceLastUpdate > m_timePerFrame && ticks < m_maxCatchUpTicks)
                 {
-                    m_window.close();
+                    timeSinceLastUpdate -= m_timePerFrame;
+                    if (ticks++ == 0)
+                        latchedInput = m_inputLatch.latch(m_inputSnapshot);
+
+                    update(m_timePerFrame);
+
+                    // Nothing left to run: the main thread closes the window
+                    if (m_stateManager.empty())
+                    {
+                        m_simulationDone = true;
+                        return;
+                    }
                 }
-            }
 
-            render();
+                // Still behind after the cap: drop the backlog so the next frame
+                // starts fresh instead of inheriting it
+                const bool behind = timeSinceLastUpdate > m_timePerFrame;
+                if (behind)
+                {
+                    m_simulationStats.droppedTime += timeSinceLastUpdate - m_timePerFrame;
+                    ++m_simulationStats.cappedFrames;
+                    timeSinceLastUpdate = m_timePerFrame;
+                }
+                adaptTimeScale(behind);
+
+                m_interpolationAlpha = timeSinceLastUpdate / m_timePerFrame;
+                recordFrame(latchedInput);
+
+                // One snapshot in flight: wait for the main thread to take it
+                // so the simulation runs at the presentation rate
+                m_frames.publish();
+                m_frames.waitUntilTaken(m_stopSimulation);
+            }
         }
+        catch (...)
+        {
+            m_simulationError = std::current_exception();
+        }
+
+        m_simulationDone = true;
     }
 
     void Game::initializeGraphics()
@@ -93,32 +192,153 @@ namespace FishGame
         scaleConfig.medium = 0.8f;
         scaleConfig.large = 1.1f;
         m_spriteManager->setScaleConfig(scaleConfig);
+
+        // Rasterize gameplay text up front so the first frenzy or big score
+        // does not stall on glyph loading
+        for (unsigned int size : Constants::WARMED_FONT_SIZES)
+            m_glyphWarmer->registerStyle(size);
+        for (const auto& [size, outline] : Constants::WARMED_OUTLINED_FONT_SIZES)
+            m_glyphWarmer->registerStyle(size, outline);
+        m_glyphWarmer->warm();
+    }
+
+    void Game::setTickRate(unsigned int tickRate)
+    {
+        m_tickRate = std::clamp(tickRate, Constants::MIN_TICK_RATE, Constants::MAX_TICK_RATE);
+        m_timePerFrame = sf::seconds(1.0f / static_cast<float>(m_tickRate));
+
+        // Same wall-clock catch-up budget at every rate: 5 ticks at 60 Hz, 20 at 240 Hz
+        m_maxCatchUpTicks = std::max(1u, static_cast<unsigned int>(
+            std::lround(Constants::MAX_CATCH_UP_TIME * static_cast<float>(m_tickRate))));
+    }
+
+    void Game::setPacingMode(PacingMode mode)
+    {
+        m_pacer.setMode(mode);
+        m_window.setVerticalSyncEnabled(mode == PacingMode::VSync);
+    }
+
+    void Game::recordFrameTime(sf::Time frameTime)
+    {
+        m_frameTimes.record(frameTime);
+
+        // Update performance metrics
+        m_metrics.accumulatedTime += frameTime;
+        ++m_metrics.frameCount;
+
+        if (m_metrics.accumulatedTime >= Constants::FPS_UPDATE_INTERVAL)
+        {
+            m_metrics.currentFPS = static_cast<float>(m_metrics.frameCount) /
+                m_metrics.accumulatedTime.asSeconds();
+            m_metrics.frameCount = 0;
+            m_metrics.accumulatedTime = sf::Time::Zero;
+        }
+
+        // Percentiles cover the last report interval so a hitch ages out
+        m_metrics.reportTime += frameTime;
+        if (m_metrics.reportTime >= Constants::FRAME_REPORT_INTERVAL)
+        {
+            // Simulation figures as of the frame on screen
+            const RenderSnapshot& frame = m_frames.front();
+            DebugOverlay::Readout readout;
+            readout.fps = m_metrics.currentFPS;
+            readout.tickRate = frame.tickRate;
+            readout.pacing = m_pacer.getMode();
+            readout.p50 = m_frameTimes.percentile(0.50f);
+            readout.p95 = m_frameTimes.percentile(0.95f);
+            readout.p99 = m_frameTimes.percentile(0.99f);
+            readout.worst = m_frameTimes.getMax();
+            readout.droppedTime = frame.stats.droppedTime;
+            readout.timeScale = frame.stats.timeScale;
+            readout.inputLatency = m_inputLatency.average;
+            readout.lazyGlyphLoads = frame.lazyGlyphLoads;
+            m_debugOverlay->update(readout);
+
+            m_frameTimes.clear();
+            m_metrics.reportTime = sf::Time::Zero;
+        }
+    }
+
+    void Game::recordInputLatency(InputLatch::Clock::time_point polledAt)
+    {
+        const auto elapsed = std::chrono::duration_cast<std::chrono::microseconds>(
+            InputLatch::Clock::now() - polledAt);
+        const sf::Time latency = sf::microseconds(elapsed.count());
+
+        // Exponential moving average; the first sample seeds it
+        m_inputLatency.last = latency;
+        m_inputLatency.average = m_inputLatency.average == sf::Time::Zero
+            ? latency
+            : m_inputLatency.average + (latency - m_inputLatency.average) * 0.1f;
+    }
+
+    void Game::adaptTimeScale(bool behind)
+    {
+        float& scale = m_simulationStats.timeScale;
+        if (!m_timeDilation)
+            scale = 1.0f;
+        else if (behind)
+            scale = std::max(Constants::MIN_TIME_SCALE, scale * 0.9f);
+        else
+            scale = std::min(1.0f, scale * 1.05f);
     }
 
     void Game::processInput()
     {
+        // Events the simulation had no room for last frame go first
+        while (!m_unsentEvents.empty() && m_events.push(m_unsentEvents.front()))
+            m_unsentEvents.pop_front();
+
         sf::Event event;
         while (m_window.pollEvent(event))
         {
+            PolledEvent polled{ event, InputLatch::Clock::now() };
+            if (event.type == sf::Event::GainedFocus)
+                polled.boundKeys = InputLatch::queryKeys();
+
             if (event.type == sf::Event::KeyPressed ||
                 event.type == sf::Event::MouseButtonPressed)
             {
                 m_window.requestFocus();
             }
-            // Process events through active states using STL algorithms
-            const auto& stack = m_stateManager.getStateStack();
-            std::for_each(stack.rbegin(),
-                stack.rend(),
-                [&event](const StateManager::StatePtr& state)
-                {
-                    state->handleEvent(event);
-                });
+            if (event.type == sf::Event::KeyPressed && event.key.code == sf::Keyboard::F3)
+            {
+                m_debugOverlay->toggle();
+            }
+
+            // The simulation drains the queue once per frame and may be
+            // waiting on this thread, so a full queue must not block here
+            if (!m_unsentEvents.empty() || !m_events.push(polled))
+                m_unsentEvents.push_back(polled);
 
             if (event.type == sf::Event::Closed)
             {
                 m_window.close();
             }
         }
+
+        const bool cursorVisible = m_cursorVisible;
+        if (cursorVisible != m_cursorShown)
+        {
+            m_window.setMouseCursorVisible(cursorVisible);
+            m_cursorShown = cursorVisible;
+        }
+    }
+
+    void Game::drainInput()
+    {
+        // Process events through active states using STL algorithms
+        const auto& stack = m_stateManager.getStateStack();
+        while (const std::optional<PolledEvent> polled = m_events.pop())
+        {
+            m_inputLatch.handleEvent(*polled);
+            std::for_each(stack.rbegin(),
+                stack.rend(),
+                [&polled](const StateManager::StatePtr& state)
+                {
+                    state->handleEvent(polled->event);
+                });
+        }
     }
 
     void Game::update(sf::Time deltaTime)
@@ -141,19 +361,39 @@ namespace FishGame
         m_stateManager.applyPendingChanges();
     }
 
-    void Game::render()
+    void Game::recordFrame(std::optional<InputLatch::Clock::time_point> latchedInput)
     {
-        m_window.clear(Constants::OCEAN_BLUE);
+        RenderSnapshot& frame = m_frames.back();
+        frame.drawList.reset(getWindowSize());
 
-        // Render all states from bottom to top using STL
+        // Record all states from bottom to top using STL
         const auto& stack = m_stateManager.getStateStack();
         std::for_each(stack.begin(), stack.end(),
-            [this](const StateManager::StatePtr& state)
+            [&frame](const StateManager::StatePtr& state)
             {
-                state->render();
+                state->render(frame.drawList);
             });
 
-        m_window.display();
+        // Recording lays out text, so this is where glyphs load
+        m_glyphWarmer->poll();
+
+        frame.stats = m_simulationStats;
+        frame.tickRate = m_tickRate;
+        frame.lazyGlyphLoads = m_glyphWarmer->getLazyLoads();
+        frame.latchedInput = latchedInput;
+    }
+
+    void Game::render()
+    {
+        m_window.clear(Constants::OCEAN_BLUE);
+        m_window.setView(m_window.getDefaultView());
+        m_frames.front().drawList.replay(m_window);
+
+        if (m_debugOverlay->isVisible())
+        {
+            m_window.setView(m_window.getDefaultView());
+            m_window.draw(*m_debugOverlay);
+        }
     }
 
     void Game::pushState(StateID id)
@@ -0,0 +1,62 @@
+#include "GlyphWarmer.h"
+#include <algorithm>
+
+namespace FishGame
+{
+    namespace
+    {
+        constexpr sf::Uint32 firstPrintable = 0x20;
+        constexpr sf::Uint32 lastPrintable = 0x7E;
+    }
+
+    GlyphWarmer::GlyphWarmer(const sf::Font& font)
+        : m_font(font)
+    {
+    }
+
+    void GlyphWarmer::registerStyle(unsigned int characterSize, float outlineThickness)
+    {
+        const bool known = std::any_of(m_styles.begin(), m_styles.end(),
+            [=](const Style& style) {
+                return style.characterSize == characterSize && style.outlineThickness == outlineThickness;
+            });
+        if (!known)
+            m_styles.push_back({ characterSize, outlineThickness });
+    }
+
+    void GlyphWarmer::warm()
+    {
+        for (const Style& style : m_styles)
+        {
+            for (sf::Uint32 c = firstPrintable; c <= lastPrintable; ++c)
+                m_font.getGlyph(c, style.characterSize, false, style.outlineThickness);
+        }
+
+        // One page per character size, shared by all its outlines
+        m_pages.clear();
+        for (const Style& style : m_styles)
+        {
+            const bool tracked = std::any_of(m_pages.begin(), m_pages.end(),
+                [&style](const Page& page) { return page.characterSize == style.characterSize; });
+            if (!tracked)
+                m_pages.push_back({ style.characterSize, m_font.getTexture(style.characterSize).getSize() });
+        }
+    }
+
+    std::size_t GlyphWarmer::poll()
+    {
+        std::size_t grown = 0;
+        for (Page& page : m_pages)
+        {
+            const sf::Vector2u size = m_font.getTexture(page.characterSize).getSize();
+            if (size != page.textureSize)
+            {
+                page.textureSize = size;
+                ++grown;
+            }
+        }
+
+        m_lazyLoads += grown;
+        return grown;
+    }
+}
@@ -0,0 +1,96 @@
+#include "InputSnapshot.h"
+#include <algorithm>
+#include <array>
+#include <utility>
+
+namespace FishGame
+{
+    namespace
+    {
+        struct Binding
+        {
+            sf::Keyboard::Key key;
+            InputMask button;
+        };
+
+        // Bit i of the tracked key state is bindings[i]
+        constexpr std::array<Binding, 8> bindings{ {
+            { sf::Keyboard::W, InputButton::Up },
+            { sf::Keyboard::Up, InputButton::Up },
+            { sf::Keyboard::S, InputButton::Down },
+            { sf::Keyboard::Down, InputButton::Down },
+            { sf::Keyboard::A, InputButton::Left },
+            { sf::Keyboard::Left, InputButton::Left },
+            { sf::Keyboard::D, InputButton::Right },
+            { sf::Keyboard::Right, InputButton::Right },
+        } };
+
+        std::uint8_t keyBit(sf::Keyboard::Key key) noexcept
+        {
+            auto it = std::find_if(bindings.begin(), bindings.end(),
+                [key](const Binding& binding) { return binding.key == key; });
+            if (it == bindings.end())
+                return 0;
+            return static_cast<std::uint8_t>(1u << (it - bindings.begin()));
+        }
+    }
+
+    void InputLatch::handleEvent(const PolledEvent& polled)
+    {
+        const sf::Event& event = polled.event;
+        switch (event.type)
+        {
+        case sf::Event::KeyPressed:
+        case sf::Event::KeyReleased:
+            if (const std::uint8_t bit = keyBit(event.key.code))
+            {
+                if (event.type == sf::Event::KeyPressed)
+                    m_keys = static_cast<std::uint8_t>(m_keys | bit);
+                else
+                    m_keys = static_cast<std::uint8_t>(m_keys & ~bit);
+
+                if (!m_pendingSince)
+                    m_pendingSince = polled.polledAt;
+            }
+            break;
+        case sf::Event::MouseMoved:
+            m_mousePosition = { event.mouseMove.x, event.mouseMove.y };
+            break;
+        case sf::Event::LostFocus:
+            // Releases are not delivered while unfocused
+            m_keys = 0;
+            break;
+        case sf::Event::GainedFocus:
+            resync(polled.boundKeys);
+            break;
+        default:
+            break;
+        }
+    }
+
+    std::uint8_t InputLatch::queryKeys()
+    {
+        std::uint8_t keys = 0;
+        for (std::size_t i = 0; i < bindings.size(); ++i)
+        {
+            if (sf::Keyboard::isKeyPressed(bindings[i].key))
+                keys = static_cast<std::uint8_t>(keys | (1u << i));
+        }
+        return keys;
+    }
+
+    std::optional<InputLatch::Clock::time_point> InputLatch::latch(InputSnapshot& snapshot)
+    {
+        InputMask held = InputButton::None;
+        for (std::size_t i = 0; i < bindings.size(); ++i)
+        {
+            if (m_keys & (1u << i))
+                held = static_cast<InputMask>(held | bindings[i].button);
+        }
+
+        snapshot.held = held;
+        snapshot.mousePosition = m_mousePosition;
+        snapshot.sequence = ++m_sequence;
+        return std::exchange(m_pendingSince, std::nullopt);
+    }
+}
@@ -1,11 +1,66 @@
 #include "Game.h"
+#include <charconv>
 #include <iostream>
+#include <string_view>
+#include <system_error>
 
-int main()
+namespace
+{
+    // Reads "--tick-rate <hz>" or "--tick-rate=<hz>" from the command line;
+    // a missing or malformed value falls back to the default with a warning
+    unsigned int tickRateFromArgs(int argc, char* argv[])
+    {
+        constexpr std::string_view flag = "--tick-rate";
+        constexpr std::string_view prefix = "--tick-rate=";
+        constexpr unsigned int fallback = FishGame::Constants::DEFAULT_TICK_RATE;
+
+        for (int i = 1; i < argc; ++i)
+        {
+            std::string_view arg = argv[i];
+
+            std::string_view value;
+            if (arg.starts_with(prefix))
+                value = arg.substr(prefix.size());
+            else if (arg == flag && i + 1 < argc)
+                value = argv[i + 1];
+            else if (arg != flag)
+                continue;
+
+            unsigned int rate = 0;
+            const auto [end, ec] = std::from_chars(value.data(), value.data() + value.size(), rate);
+            if (value.empty() || ec != std::errc() || end != value.data() + value.size())
+            {
+                std::cerr << "Warning: invalid --tick-rate value '" << value
+                    << "', using " << fallback << " Hz" << std::endl;
+                return fallback;
+            }
+            return rate;
+        }
+        return fallback;
+    }
+
+    // True if the exact flag appears on the command line
+    bool hasFlag(int argc, char* argv[], std::string_view flag)
+    {
+        for (int i = 1; i < argc; ++i)
+        {
+            if (argv[i] == flag)
+                return true;
+        }
+        return false;
+    }
+}
+
+int main(int argc, char* argv[])
 {
     try
     {
-        FishGame::Game game;
+        FishGame::Game game(tickRateFromArgs(argc, argv));
+        game.setTimeDilation(hasFlag(argc, argv, "--time-dilation"));
+        if (hasFlag(argc, argv, "--vsync"))
+            game.setPacingMode(FishGame::PacingMode::VSync);
+        else if (hasFlag(argc, argv, "--no-frame-limit"))
+            game.setPacingMode(FishGame::PacingMode::Unlimited);
         game.run();
     }
     catch (const std::exception& e)
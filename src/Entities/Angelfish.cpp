@@ -5,7 +5,7 @@
 #include "SpriteManager.h"
 #include "Animator.h"
 #include "Systems/CollisionSystem.h"
-#include "Pufferfish.h"
+#include "AISnapshot.h"
 #include <random>
 #include <algorithm>
 #include <cmath>
@@ -24,6 +24,7 @@ namespace FishGame
         , m_currentThreat(nullptr)
         , m_isEvading(false)
         , m_evasionTimer(sf::Time::Zero)
+        , m_aiRng(std::random_device{}())
     {
         // Create decorative fins
         m_fins.reserve(3);
@@ -91,131 +92,110 @@ namespace FishGame
             });
     }
 
-    void Angelfish::updateAI(const std::vector<std::unique_ptr<Entity>>& entities,
-        const Entity* player, sf::Time deltaTime)
+    void Angelfish::planAI(const AISnapshot& world, const AIEntityState& self,
+        sf::Time /*deltaTime*/)
     {
-        (void)deltaTime;
+        m_evasionPlan = EvasionPlan{};
+
         if (!m_isAlive || m_isFrozen || m_isStunned)
             return;
 
-        // Collect all potential threats
-        std::vector<const Entity*> threats;
-        threats.reserve(entities.size() + 1);
+        m_evasionPlan.active = true;
+        m_evasionPlan.isEvading = m_isEvading;
+        m_evasionPlan.evasionTimer = m_evasionTimer;
+        m_evasionPlan.threat = m_currentThreat;
+
+        auto panic = [this](const Entity* threat, sf::Time duration)
+            {
+                m_evasionPlan.isEvading = true;
+                m_evasionPlan.evasionTimer = duration;
+                m_evasionPlan.threat = threat;
+            };
 
         // Check player as threat
-        if (player && player->isAlive())
+        if (world.hasPlayer)
         {
-            float distance = EntityUtils::distance(*this, *player);
+            float distance = EntityUtils::distance(self, world.player);
 
-            if (distance < m_threatDetectionRange)
+            if (distance < m_threatDetectionRange && AISnapshot::canEat(world.player, self))
             {
-                const Player* playerPtr = dynamic_cast<const Player*>(player);
-                if (playerPtr && playerPtr->canEat(*this))
-                {
-                    threats.push_back(player);
+                addEscapeContribution(self, world.player);
 
-                    // Panic mode if very close
-                    if (distance < m_panicRange)
-                    {
-                        m_isEvading = true;
-                        m_evasionTimer = sf::seconds(2.0f);
-                        m_currentThreat = player;
-                    }
+                // Panic mode if very close
+                if (distance < m_panicRange)
+                {
+                    panic(world.player.entity, sf::seconds(2.0f));
                 }
             }
         }
 
         // Check other fish as threats
-        std::for_each(entities.begin(), entities.end(),
-            [this, &threats](const std::unique_ptr<Entity>& entity)
+        std::for_each(world.entities.begin(), world.entities.end(),
+            [this, &self, &panic](const AIEntityState& other)
             {
-                if (entity.get() == this || !entity->isAlive())
+                if (other.entity == self.entity || !other.isFish)
                     return;
 
-                const Fish* fish = dynamic_cast<const Fish*>(entity.get());
-                if (!fish)
-                    return;
+                float distance = EntityUtils::distance(self, other);
 
-                float distance = EntityUtils::distance(*this, *entity);
-
-                if (distance < m_threatDetectionRange && fish->canEat(*this))
+                if (distance < m_threatDetectionRange && AISnapshot::canEat(other, self))
                 {
-                    threats.push_back(entity.get());
+                    addEscapeContribution(self, other);
 
                     // Special case: avoid puffed pufferfish at longer range
-                    if (const Pufferfish* puffer = dynamic_cast<const Pufferfish*>(fish))
+                    if (other.isPufferfish)
                     {
-                        if (puffer->isInflated() && distance < m_threatDetectionRange * 1.5f)
+                        if (other.isInflated && distance < m_threatDetectionRange * 1.5f)
                         {
-                            m_isEvading = true;
-                            m_evasionTimer = sf::seconds(1.5f);
-                            m_currentThreat = entity.get();
+                            panic(other.entity, sf::seconds(1.5f));
                         }
                     }
                     else if (distance < m_panicRange)
                     {
-                        m_isEvading = true;
-                        m_evasionTimer = sf::seconds(2.0f);
-                        m_currentThreat = entity.get();
+                        panic(other.entity, sf::seconds(2.0f));
                     }
                 }
             });
-
-        // Calculate evasive movement
-        if (!threats.empty())
-        {
-            updateEvasiveMovement(entities, player);
-        }
     }
 
-    void Angelfish::updateEvasiveMovement(const std::vector<std::unique_ptr<Entity>>& entities,
-        const Entity* player)
+    void Angelfish::addEscapeContribution(const AIEntityState& self, const AIEntityState& threat)
     {
-        std::vector<const Entity*> threats;
+        m_evasionPlan.hasThreats = true;
+
+        sf::Vector2f toThreat = threat.position - self.position;
+        float distance = std::sqrt(toThreat.x * toThreat.x + toThreat.y * toThreat.y);
 
-        // Collect nearby threats for composite escape vector
-        if (player && player->isAlive())
+        if (distance > 0.0f)
         {
-            const Player* playerPtr = dynamic_cast<const Player*>(player);
-            if (playerPtr && playerPtr->canEat(*this))
-            {
-                float distance = EntityUtils::distance(*this, *player);
-                if (distance < m_threatDetectionRange)
-                {
-                    threats.push_back(player);
-                }
-            }
+            // Weight by inverse distance (closer = stronger repulsion)
+            float weight = 1.0f / (distance / m_panicRange);
+            weight = std::min(weight, 3.0f); // Cap the weight
+
+            sf::Vector2f escapeDir = -toThreat / distance; // Normalize and reverse
+            m_evasionPlan.escape += escapeDir * weight;
         }
+    }
 
-        std::for_each(entities.begin(), entities.end(),
-            [this, &threats](const std::unique_ptr<Entity>& entity)
-            {
-                if (entity.get() == this || !entity->isAlive())
-                    return;
+    void Angelfish::applyAI()
+    {
+        if (!m_evasionPlan.active)
+            return;
 
-                const Fish* fish = dynamic_cast<const Fish*>(entity.get());
-                if (fish && fish->canEat(*this))
-                {
-                    float distance = EntityUtils::distance(*this, *entity);
-                    if (distance < m_threatDetectionRange)
-                    {
-                        threats.push_back(entity.get());
-                    }
-                }
-            });
+        m_isEvading = m_evasionPlan.isEvading;
+        m_evasionTimer = m_evasionPlan.evasionTimer;
+        m_currentThreat = m_evasionPlan.threat;
 
-        if (!threats.empty())
+        if (m_evasionPlan.hasThreats)
         {
-            sf::Vector2f escapeVector = calculateEscapeVector(threats);
+            sf::Vector2f escapeVector = resolveEscapeVector();
 
             // Apply speed based on threat proximity
             float speed = m_isEvading ? m_evadeSpeed : m_baseSpeed;
 
             // Add some randomness to make movement less predictable
-            static std::mt19937 rng(std::random_device{}());
             std::uniform_real_distribution<float> noiseDist(-30.0f, 30.0f);
 
-            float noise = noiseDist(rng) * Constants::DEG_TO_RAD;
+            float noise = noiseDist(m_aiRng) * Constants::DEG_TO_RAD;
             float cos_n = std::cos(noise);
             float sin_n = std::sin(noise);
 
@@ -226,29 +206,13 @@ namespace FishGame
 
             m_velocity = noisyEscape * speed;
         }
+
+        m_evasionPlan = EvasionPlan{};
     }
 
-    sf::Vector2f Angelfish::calculateEscapeVector(const std::vector<const Entity*>& threats)
+    sf::Vector2f Angelfish::resolveEscapeVector()
     {
-        sf::Vector2f compositeEscape(0.0f, 0.0f);
-
-        // Calculate weighted escape vector based on threat proximity
-        std::for_each(threats.begin(), threats.end(),
-            [this, &compositeEscape](const Entity* threat)
-            {
-                sf::Vector2f toThreat = threat->getPosition() - m_position;
-                float distance = std::sqrt(toThreat.x * toThreat.x + toThreat.y * toThreat.y);
-
-                if (distance > 0.0f)
-                {
-                    // Weight by inverse distance (closer = stronger repulsion)
-                    float weight = 1.0f / (distance / m_panicRange);
-                    weight = std::min(weight, 3.0f); // Cap the weight
-
-                    sf::Vector2f escapeDir = -toThreat / distance; // Normalize and reverse
-                    compositeEscape += escapeDir * weight;
-                }
-            });
+        sf::Vector2f compositeEscape = m_evasionPlan.escape;
 
         // Normalize composite escape vector
         float length = std::sqrt(compositeEscape.x * compositeEscape.x +
@@ -261,16 +225,15 @@ namespace FishGame
         else
         {
             // No clear escape direction - pick random
-            static std::mt19937 rng(std::random_device{}());
             std::uniform_real_distribution<float> angleDist(0.0f, 360.0f);
-            float angle = angleDist(rng) * Constants::DEG_TO_RAD;
+            float angle = angleDist(m_aiRng) * Constants::DEG_TO_RAD;
             compositeEscape = sf::Vector2f(std::cos(angle), std::sin(angle));
         }
 
         return compositeEscape;
     }
 
-    void Angelfish::draw(sf::RenderTarget& target, sf::RenderStates states) const
+    void Angelfish::draw(DrawList& target, sf::RenderStates states) const
     {
         // Draw fins first
         std::for_each(m_fins.begin(), m_fins.end(),
@@ -314,7 +277,7 @@ namespace FishGame
         if (player.isInvulnerable() || system.m_playerStunned)
             return;
 
-        if (player.canEat(*this) && player.attemptEat(*this))
+        if (player.canEat(*this) && player.attemptEat(*this, system.isContactSwept()))
         {
             system.m_levelCounts[getTextureID()]++;
             system.m_sounds.play(SoundEffectID::Bite1);
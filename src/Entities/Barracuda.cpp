@@ -4,6 +4,8 @@
 #include "Player.h"
 #include "SpriteManager.h"
 #include "Animator.h"
+#include "SpriteBatch.h"
+#include "AISnapshot.h"
 #include <random>
 #include <algorithm>
 #include <cmath>
@@ -37,7 +39,7 @@ namespace FishGame
     void Barracuda::initializeSprite(SpriteManager& spriteManager)
     {
         const sf::Texture& tex = spriteManager.getTexture(getTextureID());
-        m_animator = std::make_unique<Animator>(createBarracudaAnimator(tex));
+        m_animator = std::make_unique<Animator>(createBarracudaAnimator(tex, spriteManager.getTextureOffset(getTextureID())));
 
         float scale = spriteManager.getScaleConfig().large * 1.5f;
         m_animator->setScale({ scale, scale });
@@ -77,7 +79,8 @@ namespace FishGame
                 m_turnTimer = sf::Time::Zero;
             }
 
-            m_animator->update(deltaTime);
+            if (getAnimationStep() > sf::Time::Zero)
+                m_animator->update(getAnimationStep());
 
             if (m_turning)
             {
@@ -95,7 +98,16 @@ namespace FishGame
         }
     }
 
-    void Barracuda::draw(sf::RenderTarget& target, sf::RenderStates states) const
+    bool Barracuda::appendToBatch(SpriteBatch& batch) const
+    {
+        if (!m_animator)
+            return Fish::appendToBatch(batch);
+
+        batch.add(m_animator->getSprite());
+        return true;
+    }
+
+    void Barracuda::draw(DrawList& target, sf::RenderStates states) const
     {
         if (m_animator)
             target.draw(*m_animator, states);
@@ -103,68 +115,63 @@ namespace FishGame
             Fish::draw(target, states);
     }
 
-    void Barracuda::updateAI(const std::vector<std::unique_ptr<Entity>>& entities,
-        const Entity* player, sf::Time deltaTime)
+    void Barracuda::planAI(const AISnapshot& world, const AIEntityState& self,
+        sf::Time deltaTime)
     {
+        m_huntPlan = HuntPlan{};
+
         if (!m_isAlive || m_isFrozen || m_isStunned)
             return;
 
-        // Rest of the AI logic remains the same...
-        m_huntTimer += deltaTime;
+        m_huntPlan.active = true;
+        m_huntPlan.huntTimer = m_huntTimer + deltaTime;
+        m_huntPlan.isDashing = m_isDashing;
 
         // Find closest prey
-        const Entity* closestPrey = nullptr;
+        const AIEntityState* closestPrey = nullptr;
         float closestDistance = m_huntRange;
 
         // Check player first - Barracuda can hunt player if player is smaller
-        if (player && player->isAlive())
+        if (world.hasPlayer && AISnapshot::canEat(self, world.player))
         {
-            const Player* playerPtr = dynamic_cast<const Player*>(player);
-            if (playerPtr && canEat(*player))
+            float distance = EntityUtils::distance(self, world.player);
+            if (distance < closestDistance)
             {
-                float distance = EntityUtils::distance(*this, *player);
-                if (distance < closestDistance)
-                {
-                    closestDistance = distance;
-                    closestPrey = player;
-                }
+                closestDistance = distance;
+                closestPrey = &world.player;
             }
         }
 
         // Check other fish
-        std::for_each(entities.begin(), entities.end(),
-            [this, &closestPrey, &closestDistance](const std::unique_ptr<Entity>& entity)
+        std::for_each(world.entities.begin(), world.entities.end(),
+            [&self, &closestPrey, &closestDistance](const AIEntityState& other)
             {
-                if (entity.get() == this || !entity->isAlive())
+                if (other.entity == self.entity || !AISnapshot::canEat(self, other))
                     return;
 
-                if (canEat(*entity))
+                float distance = EntityUtils::distance(self, other);
+                if (distance < closestDistance)
                 {
-                    float distance = EntityUtils::distance(*this, *entity);
-                    if (distance < closestDistance)
-                    {
-                        closestDistance = distance;
-                        closestPrey = entity.get();
-                    }
+                    closestDistance = distance;
+                    closestPrey = &other;
                 }
             });
 
         // Update hunting behavior
         if (closestPrey)
         {
-            m_currentTarget = closestPrey;
-            updateHuntingBehavior(closestPrey, deltaTime);
+            m_huntPlan.target = closestPrey->entity;
+            planHunt(self, *closestPrey);
         }
         else
         {
-            m_isDashing = false;
-            m_currentTarget = nullptr;
+            m_huntPlan.isDashing = false;
         }
     }
 
-    void Barracuda::updateHuntingBehavior(const Entity* target, sf::Time /*deltaTime*/)
+    void Barracuda::planHunt(const AIEntityState& self, const AIEntityState& target)
     {
-        sf::Vector2f direction = target->getPosition() - m_position;
+        sf::Vector2f direction = target.position - self.position;
         float distance = std::sqrt(direction.x * direction.x + direction.y * direction.y);
 
         if (distance > 0)
@@ -172,23 +179,39 @@ namespace FishGame
             direction /= distance;  // Normalize
 
             // Start dash if close enough
-            if (distance < 150.0f && !m_isDashing)
+            if (distance < 150.0f && !m_huntPlan.isDashing)
             {
-                m_isDashing = true;
-                m_huntTimer = sf::Time::Zero;
+                m_huntPlan.isDashing = true;
+                m_huntPlan.huntTimer = sf::Time::Zero;
             }
 
             // Apply speed based on state
-            float currentSpeed = m_isDashing ? m_dashSpeed : m_speed;
+            float currentSpeed = m_huntPlan.isDashing ? m_dashSpeed : m_speed;
 
             // End dash after duration
-            if (m_isDashing && m_huntTimer.asSeconds() > m_dashDuration)
+            if (m_huntPlan.isDashing && m_huntPlan.huntTimer.asSeconds() > m_dashDuration)
             {
-                m_isDashing = false;
+                m_huntPlan.isDashing = false;
             }
 
-            m_velocity = direction * currentSpeed;
+            m_huntPlan.steer = true;
+            m_huntPlan.velocity = direction * currentSpeed;
+        }
+    }
+
+    void Barracuda::applyAI()
+    {
+        if (!m_huntPlan.active)
+            return;
+
+        m_huntTimer = m_huntPlan.huntTimer;
+        m_isDashing = m_huntPlan.isDashing;
+        m_currentTarget = m_huntPlan.target;
+        if (m_huntPlan.steer)
+        {
+            m_velocity = m_huntPlan.velocity;
         }
+        m_huntPlan = HuntPlan{};
     }
 
 }
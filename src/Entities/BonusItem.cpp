@@ -2,6 +2,7 @@
 #include "GameConstants.h"
 #include "DrawHelpers.h"
 #include "SpriteManager.h"
+#include "SpriteBatch.h"
 #include "Systems/CollisionSystem.h"
 #include <cmath>
 #include <algorithm>
@@ -20,6 +21,8 @@ namespace FishGame
         , m_bobFrequency(2.0f)
         , m_baseY(0.0f)
     {
+        m_kind = EntityKind::Bonus;
+        m_collisionCategory = CollisionLayer::Bonus;
     }
 
     sf::FloatRect BonusItem::getBounds() const
@@ -128,7 +131,16 @@ namespace FishGame
         destroy();
     }
 
-    void Starfish::draw(sf::RenderTarget& target, sf::RenderStates states) const
+    bool Starfish::appendToBatch(SpriteBatch& batch) const
+    {
+        if (getRenderMode() != RenderMode::Sprite || !getSpriteComponent())
+            return false;
+
+        batch.add(getSpriteComponent()->getSprite());
+        return true;
+    }
+
+    void Starfish::draw(DrawList& target, sf::RenderStates states) const
     {
         if (getRenderMode() == RenderMode::Sprite && getSpriteComponent())
         {
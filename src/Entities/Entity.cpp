@@ -1,10 +1,20 @@
 #include "Entity.h"
 #include "SpriteComponent.h"
 #include "SpriteManager.h"
+#include "GameConstants.h"
+#include <algorithm>
 
 namespace FishGame
 {
-    Entity::Entity() = default;
+    namespace
+    {
+        EntityId s_nextEntityId = 1;
+    }
+
+    Entity::Entity()
+        : m_id(s_nextEntityId++)
+    {
+    }
 
     Entity::~Entity() = default;
 
@@ -28,6 +38,25 @@ namespace FishGame
         m_position += m_velocity * deltaTime.asSeconds();
     }
 
+    sf::Time Entity::advanceAnimationClock(sf::Time deltaTime) noexcept
+    {
+        m_animationBank += deltaTime;
+
+        const bool deferred = m_animationDetail == AnimationDetail::Hidden ||
+            (m_animationDetail == AnimationDetail::Reduced &&
+             m_animationBank < sf::seconds(Constants::ANIMATION_LOD_REDUCED_STEP));
+        if (deferred)
+        {
+            m_animationStep = sf::Time::Zero;
+            return m_animationStep;
+        }
+
+        // Long-hidden entities only need a plausible frame, not every one
+        m_animationStep = std::min(m_animationBank, sf::seconds(Constants::ANIMATION_LOD_MAX_CATCH_UP));
+        m_animationBank = sf::Time::Zero;
+        return m_animationStep;
+    }
+
     void Entity::setupSprite(SpriteManager& spriteManager, TextureID textureId)
     {
         auto sprite = spriteManager.createSpriteComponent(
@@ -89,7 +89,7 @@ void FreezePowerUp::applyEffect(Player& /*player*/, CollisionSystem& system)
     system.createParticle(getPosition(), sf::Color::Cyan, 20);
 }
 
-    void FreezePowerUp::draw(sf::RenderTarget& target, sf::RenderStates states) const
+    void FreezePowerUp::draw(DrawList& target, sf::RenderStates states) const
     {
         target.draw(m_aura, states);
         target.draw(m_iconBackground, states);
@@ -154,7 +154,7 @@ void ExtraLifePowerUp::applyEffect(Player& /*player*/, CollisionSystem& system)
     system.createParticle(getPosition(), sf::Color::Green, 15);
 }
 
-    void ExtraLifePowerUp::draw(sf::RenderTarget& target, sf::RenderStates states) const
+    void ExtraLifePowerUp::draw(DrawList& target, sf::RenderStates states) const
     {
         if (getRenderMode() == RenderMode::Sprite && getSpriteComponent())
         {
@@ -252,7 +252,7 @@ void SpeedBoostPowerUp::applyEffect(Player& player, CollisionSystem& system)
     system.createParticle(getPosition(), Constants::SPEED_BOOST_COLOR);
 }
 
-    void SpeedBoostPowerUp::draw(sf::RenderTarget& target, sf::RenderStates states) const
+    void SpeedBoostPowerUp::draw(DrawList& target, sf::RenderStates states) const
     {
         if (getRenderMode() == RenderMode::Sprite && getSpriteComponent())
         {
@@ -301,7 +301,7 @@ void AddTimePowerUp::applyEffect(Player& /*player*/, CollisionSystem& /*system*/
     // No effect defined yet
 }
 
-    void AddTimePowerUp::draw(sf::RenderTarget& target, sf::RenderStates states) const
+    void AddTimePowerUp::draw(DrawList& target, sf::RenderStates states) const
     {
         if (getRenderMode() == RenderMode::Sprite && getSpriteComponent())
         {
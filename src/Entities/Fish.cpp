@@ -1,6 +1,7 @@
 #include "Fish.h"
 #include "SpriteManager.h"
 #include "SpriteComponent.h"
+#include "SpriteBatch.h"
 #include "CollisionDetector.h"
 #include "Player.h"
 #include "Pufferfish.h"
@@ -8,6 +9,7 @@
 #include "Hazard.h"
 #include "OysterManager.h"
 #include "CollisionSystem.h"
+#include "AISnapshot.h"
 #include <cmath>
 #include <algorithm>
 
@@ -38,6 +40,9 @@ namespace FishGame
         , m_eatTimer(sf::Time::Zero)
         , m_movementStrategy(nullptr)
     {
+        m_kind = EntityKind::Fish;
+        m_sizeClass = size;
+        m_collisionCategory = CollisionLayer::forSize(size);
         // Set radius based on size
         switch (m_size)
         {
@@ -165,19 +170,20 @@ namespace FishGame
     {
         TextureID id = getTextureID();
         const sf::Texture& tex = spriteManager.getTexture(id);
+        const sf::Vector2i offset = spriteManager.getTextureOffset(id);
 
         switch (id)
         {
         case TextureID::SmallFish:
         case TextureID::PoisonFish:
         case TextureID::Angelfish:
-            m_animator = std::make_unique<Animator>(createSimpleFishAnimator(tex));
+            m_animator = std::make_unique<Animator>(createSimpleFishAnimator(tex, offset));
             break;
         case TextureID::MediumFish:
-            m_animator = std::make_unique<Animator>(createMediumFishAnimator(tex));
+            m_animator = std::make_unique<Animator>(createMediumFishAnimator(tex, offset));
             break;
         case TextureID::LargeFish:
-            m_animator = std::make_unique<Animator>(createLargeFishAnimator(tex));
+            m_animator = std::make_unique<Animator>(createLargeFishAnimator(tex, offset));
             break;
         default:
             return;
@@ -315,17 +321,12 @@ namespace FishGame
             destroy();
         }
 
-        // Update sprite or animator
+        // Update sprite or animator; frame work follows the animation LOD
+        const sf::Time animationStep = advanceAnimationClock(deltaTime);
         if (m_animator && m_renderMode == RenderMode::Sprite)
         {
             bool newFacingRight = m_velocity.x > 0.f;
-            bool inflatedPuffer = false;
-            if (const auto* puffer = dynamic_cast<const Pufferfish*>(this))
-            {
-                inflatedPuffer = puffer->isInflated();
-            }
-
-            if (!m_eating && std::abs(m_velocity.x) > 1.f && newFacingRight != m_facingRight && !inflatedPuffer)
+            if (!m_eating && std::abs(m_velocity.x) > 1.f && newFacingRight != m_facingRight && !m_isInflated)
             {
                 m_facingRight = newFacingRight;
                 std::string turn = m_facingRight ? "turnLeftToRight" : "turnRightToLeft";
@@ -335,7 +336,8 @@ namespace FishGame
                 m_turnTimer = sf::Time::Zero;
             }
 
-            m_animator->update(deltaTime);
+            if (animationStep > sf::Time::Zero)
+                m_animator->update(animationStep);
 
             if (m_eating)
             {
@@ -354,7 +356,7 @@ namespace FishGame
                 m_turnTimer += deltaTime;
                 if (m_turnTimer.asSeconds() >= m_turnDuration)
                 {
-                    if (!inflatedPuffer)
+                    if (!m_isInflated)
                     {
                         std::string swim = m_facingRight ? "swimRight" : "swimLeft";
                         m_animator->play(swim);
@@ -368,8 +370,15 @@ namespace FishGame
         }
         else if (m_sprite && m_renderMode == RenderMode::Sprite)
         {
-            m_sprite->update(deltaTime);
-            updateSpriteEffects(deltaTime);
+            if (animationStep > sf::Time::Zero)
+            {
+                m_sprite->update(animationStep);
+                updateSpriteEffects(animationStep);
+            }
+            else if (m_animationDetail != AnimationDetail::Hidden)
+            {
+                m_sprite->syncWithOwner();
+            }
         }
     }
 
@@ -416,47 +425,11 @@ namespace FishGame
         }
     }
 
-    bool Fish::canEat(const Entity& other) const
+    void Fish::planAI(const AISnapshot& world, const AIEntityState& self,
+        sf::Time /*deltaTime*/)
     {
-        // Check if it's a player
-        if (other.getType() == EntityType::Player)
-        {
-            const Player* player = dynamic_cast<const Player*>(&other);
-            if (!player)
-                return false;
-
-            // Fish can eat player if fish is larger than player's current size
-            FishSize playerSize = player->getCurrentFishSize();
-            return static_cast<int>(m_size) > static_cast<int>(playerSize);
-        }
-
-        // Check if it's another fish
-        if (other.getType() != EntityType::SmallFish &&
-            other.getType() != EntityType::MediumFish &&
-            other.getType() != EntityType::LargeFish)
-        {
-            return false;
-        }
-
-        // Cast to Fish to get size
-        const Fish* otherFish = dynamic_cast<const Fish*>(&other);
-        if (!otherFish)
-            return false;
-
-        // Special case: don't eat an inflated pufferfish
-        if (const auto* puffer = dynamic_cast<const Pufferfish*>(otherFish))
-        {
-            if (puffer->isInflated())
-                return false;
-        }
-
-        // Can eat smaller fish
-        return static_cast<int>(m_size) > static_cast<int>(otherFish->getSize());
-    }
+        m_aiPlan = AIPlan{};
 
-    void Fish::updateAI(const std::vector<std::unique_ptr<Entity>>& entities,
-        const Entity* player, sf::Time /*deltaTime*/)
-    {
         // Skip AI if frozen, fleeing, or stunned
         if (m_isFrozen || m_isFleeing || m_isStunned)
             return;
@@ -465,102 +438,103 @@ namespace FishGame
         if (m_size == FishSize::Small)
             return;
 
+        auto steerTowards = [this](const sf::Vector2f& direction)
+            {
+                m_aiPlan.steer = true;
+                m_aiPlan.direction = direction;
+            };
+
         // Check if we should flee from the player
-        if (player && player->isAlive())
+        if (world.hasPlayer)
         {
-            const Player* playerPtr = dynamic_cast<const Player*>(player);
-            if (playerPtr)
-            {
-                float distance = EntityUtils::distance(*this, *player);
+            const AIEntityState& player = world.player;
+            float distance = EntityUtils::distance(self, player);
 
-                // Check if player is larger and within flee range
-                FishSize playerSize = playerPtr->getCurrentFishSize();
+            // Check if player is larger and within flee range
+            FishSize playerSize = player.size;
 
-                bool shouldFlee = false;
-                if (m_size == FishSize::Medium)
-                {
-                    shouldFlee = (playerSize == FishSize::Medium || playerSize == FishSize::Large);
-                }
-                else if (m_size == FishSize::Large)
-                {
-                    shouldFlee = (playerSize == FishSize::Large);
-                }
+            bool shouldFlee = false;
+            if (m_size == FishSize::Medium)
+            {
+                shouldFlee = (playerSize == FishSize::Medium || playerSize == FishSize::Large);
+            }
+            else if (m_size == FishSize::Large)
+            {
+                shouldFlee = (playerSize == FishSize::Large);
+            }
 
-                if (shouldFlee && distance < AI_FLEE_RANGE)
-                {
-                    // Flee from player
-                    sf::Vector2f fleeDirection = m_position - player->getPosition();
-                    setDirection(fleeDirection.x, fleeDirection.y);
-                    return;
-                }
+            if (shouldFlee && distance < AI_FLEE_RANGE)
+            {
+                // Flee from player
+                steerTowards(self.position - player.position);
+                return;
+            }
 
-                // Check if we can hunt the player
-                if (canEat(*player) && distance < AI_DETECTION_RANGE)
-                {
-                    // Hunt the player
-                    sf::Vector2f huntDirection = player->getPosition() - m_position;
-                    setDirection(huntDirection.x, huntDirection.y);
-                    return;
-                }
+            // Check if we can hunt the player
+            if (AISnapshot::canEat(self, player) && distance < AI_DETECTION_RANGE)
+            {
+                // Hunt the player
+                steerTowards(player.position - self.position);
+                return;
             }
         }
 
-        // NEW: Check for puffed pufferfish to avoid
-        std::for_each(entities.begin(), entities.end(),
-            [this](const std::unique_ptr<Entity>& entity)
+        // Avoid puffed pufferfish
+        std::for_each(world.entities.begin(), world.entities.end(),
+            [&self, &steerTowards](const AIEntityState& other)
             {
-                if (auto* pufferfish = dynamic_cast<const Pufferfish*>(entity.get()))
+                if (other.isInflated &&
+                    EntityUtils::distance(self, other) < AI_FLEE_RANGE * 1.5f)
                 {
-                    if (pufferfish->isInflated() && pufferfish->isAlive())
-                    {
-                        float distance = EntityUtils::distance(*this, *pufferfish);
-
-                        // Avoid puffed pufferfish
-                        if (distance < AI_FLEE_RANGE * 1.5f)
-                        {
-                            sf::Vector2f avoidDirection = m_position - pufferfish->getPosition();
-                            setDirection(avoidDirection.x, avoidDirection.y);
-                            return;
-                        }
-                    }
+                    steerTowards(self.position - other.position);
                 }
             });
 
         // Hunt for smaller prey
-        const Entity* closestPrey = nullptr;
+        const AIEntityState* closestPrey = nullptr;
         float closestDistance = std::numeric_limits<float>::max();
 
         // Use STL algorithms to find closest prey
-        std::for_each(entities.begin(), entities.end(),
-            [this, &closestPrey, &closestDistance](const std::unique_ptr<Entity>& entity)
+        std::for_each(world.entities.begin(), world.entities.end(),
+            [&self, &closestPrey, &closestDistance](const AIEntityState& other)
             {
-                if (entity.get() != this && entity->isAlive() && canEat(*entity))
-                {
-                    // Skip puffed pufferfish
-                    if (auto* pufferfish = dynamic_cast<const Pufferfish*>(entity.get()))
-                    {
-                        if (pufferfish->isInflated())
-                            return;
-                    }
+                if (other.entity == self.entity || !AISnapshot::canEat(self, other))
+                    return;
 
-                    float distance = EntityUtils::distance(*this, *entity);
-                    if (distance < closestDistance && distance < AI_DETECTION_RANGE)
-                    {
-                        closestDistance = distance;
-                        closestPrey = entity.get();
-                    }
+                float distance = EntityUtils::distance(self, other);
+                if (distance < closestDistance && distance < AI_DETECTION_RANGE)
+                {
+                    closestDistance = distance;
+                    closestPrey = &other;
                 }
             });
 
         // Follow the closest prey if found
         if (closestPrey)
         {
-            sf::Vector2f direction = closestPrey->getPosition() - m_position;
-            setDirection(direction.x, direction.y);
+            steerTowards(closestPrey->position - self.position);
+        }
+    }
+
+    void Fish::applyAI()
+    {
+        if (m_aiPlan.steer)
+        {
+            setDirection(m_aiPlan.direction.x, m_aiPlan.direction.y);
         }
+        m_aiPlan = AIPlan{};
     }
 
-    void Fish::draw(sf::RenderTarget& target, sf::RenderStates states) const
+    bool Fish::appendToBatch(SpriteBatch& batch) const
+    {
+        if (m_animator)
+            batch.add(m_animator->getSprite());
+        else if (m_sprite)
+            batch.add(m_sprite->getSprite());
+        return true;
+    }
+
+    void Fish::draw(DrawList& target, sf::RenderStates states) const
     {
         if (m_animator)
         {
@@ -643,7 +617,7 @@ void Fish::onCollide(Player& player, CollisionSystem& system)
         bool playerCanEat = player.canEat(*this);
         bool fishCanEatPlayer = canEat(player);
 
-        if (playerCanEat && player.attemptEat(*this))
+        if (playerCanEat && player.attemptEat(*this, system.isContactSwept()))
         {
             system.m_levelCounts[getTextureID()]++;
             SoundEffectID effect = SoundEffectID::Bite1;
@@ -662,76 +636,7 @@ void Fish::onCollide(Player& player, CollisionSystem& system)
             playEatAnimation();
             player.takeDamage();
             system.createParticle(player.getPosition(), Constants::DAMAGE_PARTICLE_COLOR);
-            system.m_onPlayerDeath();
-        }
-    }
-
-    void Fish::onCollideWith(Entity& other, CollisionSystem& system)
-    {
-        other.onCollideWith(*this, system);
-    }
-
-    void Fish::onCollideWith(Fish& other, CollisionSystem& system)
-    {
-        if (canEat(other))
-        {
-            if (auto* poison = dynamic_cast<PoisonFish*>(&other))
-            {
-                setPoisoned(poison->getPoisonDuration());
-                system.createParticle(getPosition(), sf::Color::Magenta, 10);
-            }
-            playEatAnimation();
-            other.destroy();
-            system.createParticle(other.getPosition(), Constants::DEATH_PARTICLE_COLOR);
-        }
-        else if (other.canEat(*this))
-        {
-            if (auto* poison = dynamic_cast<PoisonFish*>(this))
-            {
-                other.setPoisoned(poison->getPoisonDuration());
-                system.createParticle(other.getPosition(), sf::Color::Magenta, 10);
-            }
-            other.playEatAnimation();
-            destroy();
-            system.createParticle(getPosition(), Constants::DEATH_PARTICLE_COLOR);
-        }
-    }
-
-    void Fish::onCollideWith(Hazard& hazard, CollisionSystem& system)
-    {
-        switch (hazard.getHazardType())
-        {
-        case HazardType::Bomb:
-            if (auto* bomb = dynamic_cast<Bomb*>(&hazard))
-            {
-                bool wasExploding = bomb->isExploding();
-                bomb->onContact(*this);
-                if (!wasExploding && bomb->isExploding())
-                {
-                    system.m_sounds.play(SoundEffectID::MineExplode);
-                }
-            }
-            break;
-        case HazardType::Jellyfish:
-            if (auto* jellyfish = dynamic_cast<Jellyfish*>(&hazard))
-            {
-                jellyfish->onContact(*this);
-                setStunned(jellyfish->getStunDuration());
-            }
-            break;
-        }
-    }
-
-    void Fish::onCollideWith(BonusItem& item, CollisionSystem& system)
-    {
-        if (auto* oyster = dynamic_cast<PermanentOyster*>(&item))
-        {
-            if (oyster->canDamagePlayer())
-            {
-                destroy();
-                system.createParticle(getPosition(), Constants::DEATH_PARTICLE_COLOR);
-                system.createParticle(oyster->getPosition(), Constants::OYSTER_IMPACT_COLOR);
-            }
+            system.requestPlayerDeath();
         }
     }
 }
@@ -2,6 +2,7 @@
 #include "Player.h"
 #include "GameConstants.h"
 #include "SpriteManager.h"
+#include "SpriteBatch.h"
 #include "Utils/AnimatedSprite.h"
 #include "Fish.h"
 #include "Systems/CollisionSystem.h"
@@ -20,6 +21,7 @@ namespace FishGame
         , m_hazardType(type)
         , m_damageAmount(damageAmount)
     {
+        m_collisionCategory = CollisionLayer::Hazard;
     }
 
     // Bomb implementation
@@ -33,6 +35,7 @@ namespace FishGame
         , m_stateTimer(sf::Time::Zero)
         , m_explosionRadius(0.f)
     {
+        m_kind = EntityKind::Bomb;
         m_radius = m_baseRadius;
         m_velocity.y = m_fallSpeed;
     }
@@ -40,7 +43,7 @@ namespace FishGame
     void Bomb::initializeSprite(SpriteManager& spriteManager)
     {
         const sf::Texture& tex = spriteManager.getTexture(TextureID::Bomb);
-        m_sprite = std::make_unique<AnimatedSprite>(tex);
+        m_sprite = std::make_unique<AnimatedSprite>(tex, spriteManager.getTextureOffset(TextureID::Bomb));
 
         AnimatedSprite::Animation idle;
         idle.frames.push_back(sf::IntRect(1, 1, 69, 69));
@@ -156,11 +159,18 @@ namespace FishGame
         onContact(player);
         system.m_sounds.play(SoundEffectID::MineExplode);
         player.takeDamage();
-        system.m_onPlayerDeath();
+        system.requestPlayerDeath();
         system.createParticle(player.getPosition(), sf::Color::Red, 20);
     }
 
-    void Bomb::draw(sf::RenderTarget& target, sf::RenderStates states) const
+    bool Bomb::appendToBatch(SpriteBatch& batch) const
+    {
+        if (m_sprite)
+            batch.add(m_sprite->getSprite());
+        return true;
+    }
+
+    void Bomb::draw(DrawList& target, sf::RenderStates states) const
     {
         if (m_sprite)
             target.draw(*m_sprite, states);
@@ -218,6 +228,7 @@ namespace FishGame
         , m_frameTimer(sf::Time::Zero)
         , m_frameWidth(0)
     {
+        m_kind = EntityKind::Jellyfish;
         m_radius = 15.0f;
 
         // Translucent bell
@@ -249,8 +260,10 @@ namespace FishGame
 
             // Set initial frame
             m_texture = &spriteManager.getTexture(TextureID::Jellyfish);
-            m_frameWidth = static_cast<int>(m_texture->getSize().x) - 2;
-            sf::IntRect rect(1, 1, m_frameWidth, m_frameHeight);
+            const sf::IntRect sheet = spriteManager.getTextureRect(TextureID::Jellyfish);
+            m_frameOrigin = { sheet.left + 1, sheet.top + 1 };
+            m_frameWidth = sheet.width - 2;
+            sf::IntRect rect(m_frameOrigin.x, m_frameOrigin.y, m_frameWidth, m_frameHeight);
             getSpriteComponent()->setTextureRect(rect);
         }
     }
@@ -260,24 +273,31 @@ namespace FishGame
         if (!m_isAlive)
             return;
 
-        if (getRenderMode() == RenderMode::Sprite && getSpriteComponent())
+        // Frame work follows the animation LOD
+        const sf::Time animationStep = advanceAnimationClock(deltaTime);
+        if (getRenderMode() == RenderMode::Sprite && getSpriteComponent() && animationStep > sf::Time::Zero)
         {
-            getSpriteComponent()->update(deltaTime);
+            getSpriteComponent()->update(animationStep);
 
             // Advance sprite animation
-            m_frameTimer += deltaTime;
+            m_frameTimer += animationStep;
             if (m_frameTimer.asSeconds() >= m_frameTime)
             {
-                m_frameTimer -= sf::seconds(m_frameTime);
-                m_frame = (m_frame + 1) % m_frameCount;
+                const int frames = static_cast<int>(m_frameTimer.asSeconds() / m_frameTime);
+                m_frameTimer -= sf::seconds(m_frameTime * static_cast<float>(frames));
+                m_frame = (m_frame + frames) % m_frameCount;
                 if (m_texture)
                 {
-                    int y = 1 + m_frame * m_frameHeight;
-                    sf::IntRect rect(1, y, m_frameWidth, m_frameHeight);
+                    int y = m_frameOrigin.y + m_frame * m_frameHeight;
+                    sf::IntRect rect(m_frameOrigin.x, y, m_frameWidth, m_frameHeight);
                     getSpriteComponent()->setTextureRect(rect);
                 }
             }
         }
+        else if (getSpriteComponent() && m_animationDetail != AnimationDetail::Hidden)
+        {
+            getSpriteComponent()->syncWithOwner();
+        }
 
         // Floating movement
         m_floatAnimation += deltaTime.asSeconds() * 2.0f;
@@ -292,21 +312,24 @@ namespace FishGame
         // Update bell
         m_bell.setPosition(m_position);
 
-        // Update tentacles with wave motion
-        auto tentIdx = std::views::iota(size_t{ 0 }, m_tentacles.size());
-        std::for_each(std::execution::unseq, tentIdx.begin(), tentIdx.end(),
-            [this](size_t i)
-            {
-                float angle = (360.0f / m_tentacleCount) * static_cast<float>(i) * Constants::DEG_TO_RAD;
-                float wave = std::sin(m_tentacleWave + static_cast<float>(i) * 0.5f) * 10.0f;
+        // Tentacles wave only while on screen
+        if (m_animationDetail != AnimationDetail::Hidden)
+        {
+            auto tentIdx = std::views::iota(size_t{ 0 }, m_tentacles.size());
+            std::for_each(std::execution::unseq, tentIdx.begin(), tentIdx.end(),
+                [this](size_t i)
+                {
+                    float angle = (360.0f / m_tentacleCount) * static_cast<float>(i) * Constants::DEG_TO_RAD;
+                    float wave = std::sin(m_tentacleWave + static_cast<float>(i) * 0.5f) * 10.0f;
 
-                sf::Vector2f tentaclePos(
-                    m_position.x + std::cos(angle) * 15.0f,
-                    m_position.y + std::sin(angle) * 15.0f);
+                    sf::Vector2f tentaclePos(
+                        m_position.x + std::cos(angle) * 15.0f,
+                        m_position.y + std::sin(angle) * 15.0f);
 
-                m_tentacles[i].setPosition(tentaclePos);
-                m_tentacles[i].setRotation((angle * Constants::RAD_TO_DEG) + 90.0f + wave);
-            });
+                    m_tentacles[i].setPosition(tentaclePos);
+                    m_tentacles[i].setRotation((angle * Constants::RAD_TO_DEG) + 90.0f + wave);
+                });
+        }
 
         // Check boundaries
         if (m_position.y > static_cast<float>(Constants::WINDOW_HEIGHT) + 100.0f)
@@ -343,7 +366,7 @@ namespace FishGame
         system.createParticle(player.getPosition(), sf::Color(255,255,0,150), 10);
     }
 
-    void Jellyfish::draw(sf::RenderTarget& target, sf::RenderStates states) const
+    void Jellyfish::draw(DrawList& target, sf::RenderStates states) const
     {
         if (getRenderMode() == RenderMode::Sprite && getSpriteComponent())
     {
@@ -375,34 +398,4 @@ void Jellyfish::pushEntity(Entity& entity) const
         entity.setVelocity(dir * m_pushForce);
         entity.setPosition(entity.getPosition() + dir * m_pushDistance);
     }
-
-    void Hazard::onCollideWith(Entity& other, CollisionSystem& system)
-    {
-        other.onCollideWith(*this, system);
-    }
-
-    void Hazard::onCollideWith(Fish& fish, CollisionSystem& system)
-    {
-        switch (getHazardType())
-        {
-        case HazardType::Bomb:
-            if (auto* bomb = dynamic_cast<Bomb*>(this))
-            {
-                bool wasExploding = bomb->isExploding();
-                bomb->onContact(fish);
-                if (!wasExploding && bomb->isExploding())
-                {
-                    system.m_sounds.play(SoundEffectID::MineExplode);
-                }
-            }
-            break;
-        case HazardType::Jellyfish:
-            if (auto* jellyfish = dynamic_cast<Jellyfish*>(this))
-            {
-                jellyfish->onContact(fish);
-                fish.setStunned(jellyfish->getStunDuration());
-            }
-            break;
-        }
-    }
 }
@@ -57,6 +57,8 @@ namespace FishGame
         , m_visual(std::make_unique<PlayerVisual>(*this))
         , m_facingRight(false)
     {
+        m_kind = EntityKind::Player;
+        m_collisionCategory = CollisionLayer::Player;
         m_radius = m_baseRadius;
 
         // Start at center of screen
@@ -64,6 +66,7 @@ namespace FishGame
             static_cast<float>(m_windowBounds.x) / 2.0f,
             static_cast<float>(m_windowBounds.y) / 2.0f);
         m_targetPosition = m_position;
+        resetSweep();
     }
 
     void Player::initializeSystems(GrowthMeter* growthMeter, FrenzySystem* frenzySystem,
@@ -86,7 +89,7 @@ namespace FishGame
         m_spriteManager = &spriteManager;
 
         const sf::Texture& tex = spriteManager.getTexture(getTextureID());
-        m_animator = std::make_unique<Animator>(createFishAnimator(tex));
+        m_animator = std::make_unique<Animator>(createFishAnimator(tex, spriteManager.getTextureOffset(getTextureID())));
         m_animator->setPosition(m_position);
         setRenderMode(RenderMode::Sprite);
         m_currentAnimation = "idleLeft";
@@ -124,7 +127,7 @@ namespace FishGame
         }
 
         // Handle input
-        handleInput();
+        handleInput(deltaTime);
 
 
         // Limit maximum speed
@@ -207,10 +210,16 @@ namespace FishGame
         }
     }
 
-    void Player::handleInput()
+    void Player::setInputSource(const InputSnapshot* source)
     {
         if (m_input)
-            m_input->handleInput();
+            m_input->setSource(source);
+    }
+
+    void Player::handleInput(sf::Time deltaTime)
+    {
+        if (m_input)
+            m_input->handleInput(deltaTime);
     }
 
     sf::FloatRect Player::getBounds() const
@@ -253,9 +262,9 @@ bool Player::canEat(const Entity& other) const
     return m_status ? m_status->canEat(other) : false;
 }
 
-bool Player::attemptEat(Entity& other)
+bool Player::attemptEat(Entity& other, bool swept)
 {
-    return m_status ? m_status->attemptEat(other) : false;
+    return m_status ? m_status->attemptEat(other, swept) : false;
 }
 
 bool Player::canTailBite(const Entity& other) const
@@ -349,7 +358,7 @@ void Player::setWindowBounds(const sf::Vector2u& windowSize)
     m_windowBounds = windowSize;
 }
 
-void Player::draw(sf::RenderTarget& target, sf::RenderStates states) const
+void Player::draw(DrawList& target, sf::RenderStates states) const
 {
     if (m_visual)
         m_visual->draw(target, states);
@@ -368,20 +377,5 @@ void Player::updateVisualEffects(sf::Time deltaTime)
     if (m_visual)
         m_visual->update(deltaTime);
 }
-
-    void Player::onCollideWith(Entity& other, CollisionSystem& system)
-    {
-        other.onCollide(*this, system);
-    }
-
-    void Player::onCollideWith(Fish& fish, CollisionSystem& system)
-    {
-        fish.onCollide(*this, system);
-    }
-
-    void Player::onCollideWith(Hazard& hazard, CollisionSystem& system)
-    {
-        hazard.onCollide(*this, system);
-    }
 }
 
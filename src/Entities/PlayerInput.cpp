@@ -1,37 +1,25 @@
 #include "PlayerInput.h"
 #include "Player.h"
-#include <SFML/Window/Keyboard.hpp>
 #include <cmath>
 
 namespace FishGame {
 
 PlayerInput::PlayerInput(Player& player) : m_player(player) {}
 
-void PlayerInput::handleInput()
+void PlayerInput::handleInput(sf::Time deltaTime)
 {
     sf::Vector2f inputDirection(0.f, 0.f);
-    bool keyboardUsed = false;
+    const InputMask held = m_source ? m_source->held : InputButton::None;
+    const bool keyboardUsed = (held & InputButton::Movement) != 0;
 
-    if (sf::Keyboard::isKeyPressed(sf::Keyboard::W) || sf::Keyboard::isKeyPressed(sf::Keyboard::Up))
-    {
+    if (held & InputButton::Up)
         inputDirection.y -= 1.f;
-        keyboardUsed = true;
-    }
-    if (sf::Keyboard::isKeyPressed(sf::Keyboard::S) || sf::Keyboard::isKeyPressed(sf::Keyboard::Down))
-    {
+    if (held & InputButton::Down)
         inputDirection.y += 1.f;
-        keyboardUsed = true;
-    }
-    if (sf::Keyboard::isKeyPressed(sf::Keyboard::A) || sf::Keyboard::isKeyPressed(sf::Keyboard::Left))
-    {
+    if (held & InputButton::Left)
         inputDirection.x -= 1.f;
-        keyboardUsed = true;
-    }
-    if (sf::Keyboard::isKeyPressed(sf::Keyboard::D) || sf::Keyboard::isKeyPressed(sf::Keyboard::Right))
-    {
+    if (held & InputButton::Right)
         inputDirection.x += 1.f;
-        keyboardUsed = true;
-    }
 
     if (m_player.areControlsReversed())
     {
@@ -51,7 +39,8 @@ void PlayerInput::handleInput()
     }
     else
     {
-        m_player.setVelocity(m_player.getVelocity() * 0.9f);
+        const float retained = std::exp(-Constants::PLAYER_COAST_DRAG * deltaTime.asSeconds());
+        m_player.setVelocity(m_player.getVelocity() * retained);
     }
 }
 
@@ -38,25 +38,10 @@ bool PlayerStatus::canEat(const Entity& other) const
     if (m_invulnerabilityTimer > sf::Time::Zero)
         return false;
 
-    EntityType otherType = other.getType();
-    if (otherType == EntityType::SmallFish ||
-        otherType == EntityType::MediumFish ||
-        otherType == EntityType::LargeFish)
-    {
-        const Fish* fish = dynamic_cast<const Fish*>(&other);
-        if (!fish)
-            return false;
-
-        FishSize playerSize = m_player.getCurrentFishSize();
-        FishSize fishSize = fish->getSize();
-
-        return static_cast<int>(playerSize) >= static_cast<int>(fishSize);
-    }
-
-    return false;
+    return Predation::canEat(m_player, other);
 }
 
-bool PlayerStatus::attemptEat(Entity& other)
+bool PlayerStatus::attemptEat(Entity& other, bool swept)
 {
     if (!canEat(other))
         return false;
@@ -66,14 +51,24 @@ bool PlayerStatus::attemptEat(Entity& other)
 
     sf::Vector2f mouthPos = m_player.getPosition() + mouthOffset * 0.8f;
     float mouthRadius = m_player.getRadius() * 0.5f;
+    const float reach = mouthRadius + other.getRadius();
 
-    float distance = CollisionDetector::getDistance(mouthPos, other.getPosition());
-    if (distance > mouthRadius + other.getRadius())
+    if (swept)
+    {
+        // A fast pass can cross the fish mid-tick and end past it, so sweep
+        // the mouth along both paths instead of testing where they ended up
+        if (EntityUtils::timeOfImpact(m_player.getSweepStart() + mouthOffset * 0.8f, m_player.getSweepDelta(),
+                                      other.getSweepStart(), other.getSweepDelta(), reach) < 0.f)
+            return false;
+    }
+    else if (CollisionDetector::getDistance(mouthPos, other.getPosition()) > reach)
+    {
         return false;
+    }
 
-    const Fish* fish = dynamic_cast<const Fish*>(&other);
-    if (fish)
+    if (isFishKind(other.getKind()))
     {
+        const auto* fish = static_cast<const Fish*>(&other);
         m_player.addPoints(fish->getScorePoints());
         m_player.grow(fish->getPointValue());
 
@@ -109,11 +104,10 @@ bool PlayerStatus::attemptEat(Entity& other)
 
 bool PlayerStatus::canTailBite(const Entity& other) const
 {
-    const Fish* fish = dynamic_cast<const Fish*>(&other);
-    if (!fish)
+    if (!isFishKind(other.getKind()))
         return false;
 
-    int sizeDifference = static_cast<int>(fish->getSize()) - static_cast<int>(m_player.getCurrentFishSize());
+    int sizeDifference = static_cast<int>(other.getSizeClass()) - static_cast<int>(m_player.getCurrentFishSize());
     return sizeDifference >= 2;
 }
 
@@ -175,6 +169,8 @@ void PlayerStatus::die()
                            static_cast<float>(m_player.m_windowBounds.y) / 2.f};
     m_player.m_velocity = {0.f, 0.f};
     m_player.m_targetPosition = m_player.m_position;
+    m_player.resetSweep();
+    m_player.storePreviousPosition();
 
     m_invulnerabilityTimer = m_invulnerabilityDuration;
 
@@ -198,6 +194,8 @@ void PlayerStatus::respawn()
                            static_cast<float>(m_player.m_windowBounds.y) / 2.f};
     m_player.m_velocity = {0.f, 0.f};
     m_player.m_targetPosition = m_player.m_position;
+    m_player.resetSweep();
+    m_player.storePreviousPosition();
     m_invulnerabilityTimer = m_invulnerabilityDuration;
     m_player.m_controlsReversed = false;
     m_player.m_poisonColorTimer = sf::Time::Zero;
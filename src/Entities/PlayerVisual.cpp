@@ -102,7 +102,7 @@ void PlayerVisual::update(sf::Time deltaTime)
         m_player.getAnimator()->setColor(currentColor);
 }
 
-void PlayerVisual::draw(sf::RenderTarget& target, sf::RenderStates states) const
+void PlayerVisual::draw(DrawList& target, sf::RenderStates states) const
 {
     if (!m_player.isAlive())
         return;
@@ -22,6 +22,7 @@ namespace FishGame
         , m_poisonDuration(sf::seconds(m_poisonEffectDuration))
         , m_poisonPoints(m_basePoisonPoints* currentLevel)
     {
+        m_kind = EntityKind::PoisonFish;
         // Purple poisonous appearance
         m_pointValue = 0;
 
@@ -59,8 +60,9 @@ namespace FishGame
             m_wobbleAnimation += deltaTime.asSeconds() * 3.0f;
         }
 
-        // Update poison bubbles
-        updatePoisonBubbles(deltaTime);
+        // Bubbles are only drawn on screen
+        if (m_animationDetail != AnimationDetail::Hidden)
+            updatePoisonBubbles(deltaTime);
     }
 
     void PoisonFish::updatePoisonBubbles(sf::Time /*deltaTime*/)
@@ -84,7 +86,7 @@ namespace FishGame
             });
     }
 
-    void PoisonFish::draw(sf::RenderTarget& target, sf::RenderStates states) const
+    void PoisonFish::draw(DrawList& target, sf::RenderStates states) const
     {
         // Draw poison bubbles first
         std::for_each(m_poisonBubbles.begin(), m_poisonBubbles.end(),
@@ -101,7 +103,7 @@ namespace FishGame
         if (player.isInvulnerable() || system.m_playerStunned)
             return;
 
-        if (player.canEat(*this) && player.attemptEat(*this))
+        if (player.canEat(*this) && player.attemptEat(*this, system.isContactSwept()))
         {
             system.m_reverseControls();
             system.m_controlReverseTimer = getPoisonDuration();
@@ -5,6 +5,7 @@
 #include <cmath>
 #include <algorithm>
 #include <iterator>
+#include <numeric>
 #include <ranges>
 #include <execution>
 
@@ -100,7 +101,7 @@ void ScoreDoublerPowerUp::applyEffect(Player& /*player*/, CollisionSystem& syste
     system.createParticle(getPosition(), Constants::SCORE_DOUBLER_COLOR);
 }
 
-    void ScoreDoublerPowerUp::draw(sf::RenderTarget& target, sf::RenderStates states) const
+    void ScoreDoublerPowerUp::draw(DrawList& target, sf::RenderStates states) const
     {
         target.draw(m_aura, states);
         target.draw(m_iconBackground, states);
@@ -180,7 +181,7 @@ void FrenzyStarterPowerUp::applyEffect(Player& /*player*/, CollisionSystem& syst
     system.createParticle(getPosition(), Constants::FRENZY_STARTER_COLOR);
 }
 
-    void FrenzyStarterPowerUp::draw(sf::RenderTarget& target, sf::RenderStates states) const
+    void FrenzyStarterPowerUp::draw(DrawList& target, sf::RenderStates states) const
     {
         target.draw(m_aura, states);
         target.draw(m_iconBackground, states);
@@ -284,4 +285,11 @@ void FrenzyStarterPowerUp::applyEffect(Player& /*player*/, CollisionSystem& syst
 
         return activeTypes;
     }
+
+    std::uint32_t PowerUpManager::getActiveMask() const
+    {
+        return std::accumulate(m_activePowerUps.begin(), m_activePowerUps.end(), std::uint32_t{ 0 },
+            [](std::uint32_t mask, const ActivePowerUp& powerUp)
+            { return mask | (1u << static_cast<unsigned>(powerUp.type)); });
+    }
 }
@@ -17,13 +17,13 @@ namespace FishGame
     // Pufferfish implementation
     Pufferfish::Pufferfish(int currentLevel)
         : AdvancedFish(FishSize::Medium, 100.0f, currentLevel, MovementPattern::Sinusoidal)
-        , m_isPuffed(false)
         , m_stateTimer(sf::Time::Zero)
         , m_inflationLevel(0.0f)
         , m_normalRadius(25.0f)
         , m_isPuffing(false)
         , m_puffTimer(sf::Time::Zero)
     {
+        m_kind = EntityKind::Pufferfish;
         m_radius = m_normalRadius;
 
         // Create spikes
@@ -39,7 +39,7 @@ namespace FishGame
     void Pufferfish::initializeSprite(SpriteManager& spriteManager)
     {
         const sf::Texture& tex = spriteManager.getTexture(getTextureID());
-        m_animator = std::make_unique<Animator>(createPufferfishAnimator(tex));
+        m_animator = std::make_unique<Animator>(createPufferfishAnimator(tex, spriteManager.getTextureOffset(getTextureID())));
 
         float scale = spriteManager.getScaleConfig().medium;
         m_animator->setScale({ scale, scale });
@@ -54,6 +54,8 @@ namespace FishGame
 
     void Pufferfish::update(sf::Time deltaTime)
     {
+        m_bounceCooldown = std::max(sf::Time::Zero, m_bounceCooldown - deltaTime);
+
         // Check base frozen state first
         if (m_isFrozen)
         {
@@ -61,20 +63,8 @@ namespace FishGame
             updateMovement(deltaTime);
 
             // Still update visual elements but not state transitions
-            auto spikeIdx = std::views::iota(size_t{ 0 }, m_spikes.size());
-            std::for_each(std::execution::unseq, spikeIdx.begin(), spikeIdx.end(),
-                [this](size_t i)
-                {
-                    float angle = (360.0f / m_spikeCount) * static_cast<float>(i) * Constants::DEG_TO_RAD;
-                    float spikeRadius = m_radius + (m_inflationLevel * 10.0f);
-
-                    sf::Vector2f spikePos(
-                        m_position.x + std::cos(angle) * spikeRadius,
-                        m_position.y + std::sin(angle) * spikeRadius);
-
-                    m_spikes[i].setPosition(spikePos);
-                    m_spikes[i].setRotation(angle * Constants::RAD_TO_DEG);
-                });
+            if (m_animationDetail != AnimationDetail::Hidden)
+                updateSpikes();
             return;
         }
 
@@ -107,9 +97,15 @@ namespace FishGame
             }
         }
 
-        // Update spike positions
-        auto spikeIdx2 = std::views::iota(size_t{ 0 }, m_spikes.size());
-        std::for_each(std::execution::unseq, spikeIdx2.begin(), spikeIdx2.end(),
+        // Spikes are only drawn on screen
+        if (m_animationDetail != AnimationDetail::Hidden)
+            updateSpikes();
+    }
+
+    void Pufferfish::updateSpikes()
+    {
+        auto spikeIdx = std::views::iota(size_t{ 0 }, m_spikes.size());
+        std::for_each(std::execution::unseq, spikeIdx.begin(), spikeIdx.end(),
             [this](size_t i)
             {
                 float angle = (360.0f / m_spikeCount) * static_cast<float>(i) * Constants::DEG_TO_RAD;
@@ -124,15 +120,6 @@ namespace FishGame
             });
     }
 
-    bool Pufferfish::canEat(const Entity& other) const
-    {
-        // Pufferfish can't eat when inflated
-        if (isInflated())
-            return false;
-
-        return Fish::canEat(other);
-    }
-
     void Pufferfish::pushEntity(Entity& entity)
     {
         if (!isInflated() || !canPushEntity(entity))
@@ -168,7 +155,14 @@ namespace FishGame
         return distance < pushRadius;
     }
 
-    void Pufferfish::draw(sf::RenderTarget& target, sf::RenderStates states) const
+    bool Pufferfish::appendToBatch(SpriteBatch& batch) const
+    {
+        if (m_inflationLevel > 0.2f)
+            return false;
+        return Fish::appendToBatch(batch);
+    }
+
+    void Pufferfish::draw(DrawList& target, sf::RenderStates states) const
     {
         Fish::draw(target, states);
 
@@ -188,7 +182,7 @@ namespace FishGame
     {
         m_stateTimer += deltaTime;
 
-        if (!m_isPuffed)
+        if (!m_isInflated)
         {
             // Normal state
             if (m_stateTimer.asSeconds() >= m_normalStateDuration)
@@ -251,7 +245,7 @@ namespace FishGame
 
     void Pufferfish::transitionToInflated()
     {
-        m_isPuffed = true;
+        m_isInflated = true;
         m_stateTimer = sf::Time::Zero;
         m_isPuffing = true;
         m_puffTimer = sf::Time::Zero;
@@ -269,7 +263,7 @@ namespace FishGame
 
     void Pufferfish::transitionToNormal()
     {
-        m_isPuffed = false;
+        m_isInflated = false;
         m_stateTimer = sf::Time::Zero;
         m_puffPhase = PuffPhase::None;
         if (m_animator)
@@ -287,8 +281,11 @@ namespace FishGame
 
         if (isInflated())
         {
-            if (!player.hasRecentlyTakenDamage())
+            // A lasting contact bounces once per cooldown rather than once
+            // per tick, so the push and penalty do not scale with the tick rate
+            if (!player.hasRecentlyTakenDamage() && m_bounceCooldown <= sf::Time::Zero)
             {
+                m_bounceCooldown = sf::seconds(Constants::PUFFERFISH_BOUNCE_COOLDOWN);
                 pushEntity(player);
                 system.m_sounds.play(SoundEffectID::PufferBounce);
                 int penalty = Constants::PUFFERFISH_SCORE_PENALTY;
@@ -298,7 +295,7 @@ namespace FishGame
         }
         else if (player.canEat(*this))
         {
-            if (player.attemptEat(*this))
+            if (player.attemptEat(*this, system.isContactSwept()))
             {
                 system.m_levelCounts[getTextureID()]++;
                 system.m_sounds.play(SoundEffectID::Bite2);
@@ -310,7 +307,7 @@ namespace FishGame
         {
             player.takeDamage();
             system.createParticle(player.getPosition(), Constants::DAMAGE_PARTICLE_COLOR);
-            system.m_onPlayerDeath();
+            system.requestPlayerDeath();
         }
     }
 
@@ -1,5 +1,6 @@
 #include "OysterManager.h"
 #include "SpriteManager.h"
+#include "SpriteBatch.h"
 #include <algorithm>
 
 namespace FishGame
@@ -12,6 +13,8 @@ namespace FishGame
         , m_recentlyCollected(false)
         , m_collectionCooldown(sf::Time::Zero)
     {
+        m_kind = EntityKind::Oyster;
+        m_collisionCategory = CollisionLayer::Oyster;
         m_radius = 30.0f;   
         m_lifetime = sf::seconds(999999.0f);
     }
@@ -65,6 +68,9 @@ namespace FishGame
         m_oysterTexture = &spriteManager.getTexture(TextureID::PearlOysterClosed);
         m_whitePearlTex = &spriteManager.getTexture(TextureID::WhitePearl);
         m_blackPearlTex = &spriteManager.getTexture(TextureID::BlackPearl);
+        m_oysterOffset = spriteManager.getTextureOffset(TextureID::PearlOysterClosed);
+        m_whitePearlRect = spriteManager.getTextureRect(TextureID::WhitePearl);
+        m_blackPearlRect = spriteManager.getTextureRect(TextureID::BlackPearl);
 
         m_sprite.setTexture(*m_oysterTexture);
         m_sprite.setOrigin(50.f, 50.f);
@@ -137,7 +143,7 @@ namespace FishGame
 
         const int frameW = 101;
         const int frameH = 101;
-        sf::IntRect rect(1 + m_frame * frameW, 1, frameW, frameH);
+        sf::IntRect rect(m_oysterOffset.x + 1 + m_frame * frameW, m_oysterOffset.y + 1, frameW, frameH);
         m_sprite.setTextureRect(rect);
         m_sprite.setPosition(m_position);
 
@@ -156,6 +162,7 @@ namespace FishGame
             m_hasBlackPearl = false;
             m_points = m_whitePearlPoints;
             m_pearlSprite.setTexture(*m_whitePearlTex);
+            m_pearlSprite.setTextureRect(m_whitePearlRect);
         }
         else
         {
@@ -163,11 +170,21 @@ namespace FishGame
             m_hasBlackPearl = true;
             m_points = m_blackPearlPoints;
             m_pearlSprite.setTexture(*m_blackPearlTex);
+            m_pearlSprite.setTextureRect(m_blackPearlRect);
         }
         m_hasPearlSprite = true;
     }
 
-    void PermanentOyster::draw(sf::RenderTarget& target, sf::RenderStates states) const
+    bool PermanentOyster::appendToBatch(SpriteBatch& batch) const
+    {
+        // Pearls sit on the layer above every shell
+        batch.add(m_sprite);
+        if (m_hasPearlSprite)
+            batch.add(m_pearlSprite, 1);
+        return true;
+    }
+
+    void PermanentOyster::draw(DrawList& target, sf::RenderStates states) const
     {
         target.draw(m_sprite, states);
         if (m_hasPearlSprite)
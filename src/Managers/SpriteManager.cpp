@@ -75,15 +75,40 @@ namespace FishGame
     {
     }
 
+    bool SpriteManager::isAtlased(TextureID id)
+    {
+        return static_cast<int>(id) < static_cast<int>(TextureID::Background1);
+    }
+
 void SpriteManager::loadTextures(const std::string& assetPath)
 {
         m_textureHolder.reserve(s_textureFiles.size());
 
+        // Shared files are decoded once and map to the same atlas region
+        std::unordered_map<std::string, std::size_t> atlasFiles;
+
         // Load textures sequentially using the existing window context
         for (const auto& [id, filename] : s_textureFiles)
         {
             std::string fullPath = assetPath.empty() ? filename
                 : assetPath + "/" + filename;
+
+            if (isAtlased(id))
+            {
+                auto file = atlasFiles.find(filename);
+                if (file == atlasFiles.end())
+                {
+                    sf::Image image;
+                    if (!image.loadFromFile(fullPath))
+                    {
+                        throw ResourceLoadException("Failed to load texture: " + fullPath);
+                    }
+                    file = atlasFiles.emplace(filename, m_atlas.add(std::move(image))).first;
+                }
+                m_atlasHandles[id] = file->second;
+                continue;
+            }
+
             auto tex = std::make_unique<sf::Texture>();
             if (!tex->loadFromFile(fullPath))
             {
@@ -91,13 +116,80 @@ void SpriteManager::loadTextures(const std::string& assetPath)
             }
             m_textureHolder.insert(id, std::move(tex));
         }
+
+        m_atlas.build();
 }
 
     const sf::Texture& SpriteManager::getTexture(TextureID id) const
     {
+        if (auto it = m_atlasHandles.find(id); it != m_atlasHandles.end())
+            return m_atlas.getPage(m_atlas.getRegion(it->second).page);
+
         return m_textureHolder.get(id);
     }
 
+    sf::IntRect SpriteManager::getTextureRect(TextureID id) const
+    {
+        if (auto it = m_atlasHandles.find(id); it != m_atlasHandles.end())
+            return m_atlas.getRegion(it->second).rect;
+
+        const sf::Vector2u size = m_textureHolder.get(id).getSize();
+        return { 0, 0, static_cast<int>(size.x), static_cast<int>(size.y) };
+    }
+
+    sf::Vector2i SpriteManager::getTextureOffset(TextureID id) const
+    {
+        const sf::IntRect rect = getTextureRect(id);
+        return { rect.left, rect.top };
+    }
+
+    sf::IntRect SpriteManager::getFirstFrameRect(TextureID id) const
+    {
+        sf::IntRect frame;
+        switch (id)
+        {
+        case TextureID::SmallFish:
+        case TextureID::PoisonFish:
+        case TextureID::Angelfish:
+            frame = { 1, 1, 66, 44 };
+            break;
+        case TextureID::MediumFish:
+            frame = { 1, 1, 172, 108 };
+            break;
+        case TextureID::LargeFish:
+            frame = { 1, 1, 201, 148 };
+            break;
+        case TextureID::PearlOysterClosed:
+            frame = { 1, 1, 101, 101 };
+            break;
+        case TextureID::PearlOysterOpen:
+            frame = { 1 + 4 * 101, 1, 101, 101 };
+            break;
+        case TextureID::Bomb:
+            frame = { 1, 1, 69, 69 };
+            break;
+        case TextureID::Pufferfish:
+            frame = { 5, 5, 187, 131 };
+            break;
+        case TextureID::PufferfishInflated:
+            frame = { 5, 136, 186, 169 };
+            break;
+        case TextureID::Jellyfish:
+            frame = { 1, 1, 75, 197 };
+            break;
+        case TextureID::Barracuda:
+            frame = { 1, 1, 270, 122 };
+            break;
+        default:
+            return getTextureRect(id);
+        }
+
+        const sf::Vector2i offset = getTextureOffset(id);
+        frame.left += offset.x;
+        frame.top += offset.y;
+        return frame;
+    }
+
     template<typename EntityType>
     std::unique_ptr<SpriteComponent<EntityType>> SpriteManager::createSpriteComponent(
         EntityType* owner, TextureID textureId)
@@ -105,7 +197,7 @@ void SpriteManager::loadTextures(const std::string& assetPath)
         auto component = std::make_unique<SpriteComponent<EntityType>>(owner);
 
         // Set texture
-        component->setTexture(getTexture(textureId));
+        component->setTexture(getTexture(textureId), getTextureRect(textureId));
 
         // Apply default configuration
         SpriteConfig<EntityType> config = getSpriteConfig<EntityType>(textureId);
@@ -9,6 +9,7 @@
 #include "Hazard.h"
 #include "FishCollisionHandler.h"
 #include "OysterManager.h"
+#include "StateUtils.h"
 #include "MusicPlayer.h"
 #include "StageIntroState.h"
 #include <algorithm>
@@ -29,7 +30,7 @@ namespace FishGame
         , m_bonusItems()
         , m_hazards()
         , m_environment(std::make_unique<EnvironmentSystem>())
-        , m_backgroundSprite()
+        , m_background()
         , m_timeLimit(sf::Time::Zero)
         , m_timeElapsed(sf::Time::Zero)
         , m_objective()
@@ -73,14 +74,13 @@ namespace FishGame
         m_instructionText.setFillColor(sf::Color::White);
 
         // Background image for bonus stage
-        auto& window = getGame().getWindow();
-        m_backgroundSprite.setTexture(
-            getGame().getSpriteManager().getTexture(TextureID::Background6));
-        sf::Vector2f winSize(window.getSize());
-        sf::Vector2f texSize(m_backgroundSprite.getTexture()->getSize());
-        m_backgroundSprite.setScale(winSize.x / texSize.x, winSize.y / texSize.y);
-
-        sf::View view = window.getDefaultView();
+        const sf::Vector2u windowSize = getGame().getWindowSize();
+        m_background.setTexture(
+            getGame().getSpriteManager().getTexture(TextureID::Background6), windowSize);
+        m_environment->setLightingOverlayEnabled(false);
+        sf::Vector2f winSize(windowSize);
+
+        sf::View view(sf::FloatRect(0.f, 0.f, winSize.x, winSize.y));
         view.zoom(Constants::CAMERA_ZOOM_FACTOR);
         view.setCenter(winSize * 0.5f);
         m_camera = CameraController(view, winSize);
@@ -107,6 +107,8 @@ namespace FishGame
             m_timeLimit = sf::seconds(m_treasureHuntDuration);
             m_objective = { "Collect Pearl Oysters!", m_requiredPearlCount, 0, 100 };
             m_environment->setEnvironment(EnvironmentType::CoralReef);
+            // No bombs here, so fish never need hazard contacts
+            m_collisionFilter.deny(CollisionLayer::AnyFish, CollisionLayer::Hazard);
             break;
 
         case BonusStageType::FeedingFrenzy:
@@ -119,15 +121,17 @@ namespace FishGame
             m_timeLimit = sf::seconds(m_survivalDuration);
             m_objective = { "Survive the Predators!", 1, 0, 1000 };
             m_environment->setEnvironment(EnvironmentType::KelpForest);
+            m_collisionFilter.deny(CollisionLayer::AnyFish, CollisionLayer::Hazard);
             break;
         }
 
         // Initialize player
-        m_player->setWindowBounds(getGame().getWindow().getSize());
+        m_player->setWindowBounds(getGame().getWindowSize());
         m_player->setPosition(Constants::BONUS_STAGE_PLAYER_X,
                               Constants::BONUS_STAGE_PLAYER_Y);
         m_player->initializeSprite(getGame().getSpriteManager());
         m_player->setSoundPlayer(&getGame().getSoundPlayer());
+        m_player->setInputSource(&getGame().getInputSnapshot());
 
         // Reserve containers
         m_entities.reserve(Constants::BONUS_ENTITIES_RESERVE);
@@ -151,6 +155,13 @@ namespace FishGame
 
     bool BonusStageState::update(sf::Time deltaTime)
     {
+        const auto storePrevious = [](Entity& entity) { entity.storePreviousPosition(); };
+        StateUtils::applyToEntities(m_entities, storePrevious);
+        StateUtils::applyToEntities(m_bonusItems, storePrevious);
+        StateUtils::applyToEntities(m_hazards, storePrevious);
+        m_player->storePreviousPosition();
+        m_camera.storePreviousCenter();
+
         if (m_stageComplete)
         {
             processDeferredActions();
@@ -212,7 +223,7 @@ namespace FishGame
             entity->update(deltaTime);
 
             // Apply ocean currents to fish
-            if (Fish* fish = dynamic_cast<Fish*>(entity.get()))
+            if (isFishKind(entity->getKind()))
             {
                 sf::Vector2f force = m_environment->getOceanCurrentForce(entity->getPosition());
                 entity->setVelocity(entity->getVelocity() + force * deltaTime.asSeconds() * 0.5f);
@@ -261,10 +272,11 @@ namespace FishGame
             });
 
         ::FishGame::FishCollisionHandler::processFishHazardCollisions(
-            m_entities, m_hazards, &getGame().getSoundPlayer());
+            m_entities, m_hazards, &getGame().getSoundPlayer(), m_collisionFilter);
 
-        // Process bomb explosions affecting entities
-        ::FishGame::processBombExplosions(m_entities, m_hazards);
+        // Process bomb explosions affecting entities, chaining into nearby bombs
+        rebuildCollisionGrid();
+        ::FishGame::processBombExplosions(m_collisionGrid, m_hazards);
 
         // Remove dead entities
         m_entities.erase(
@@ -311,54 +323,44 @@ namespace FishGame
         scoreStream << "Bonus Score: " << m_bonusScore;
         m_scoreText.setString(scoreStream.str());
 
-        updateCamera();
+        updateCamera(deltaTime);
         processDeferredActions();
         return false;
     }
 
-    void BonusStageState::render()
+    void BonusStageState::render(DrawList& target)
     {
-        auto& window = getGame().getWindow();
-        auto defaultView = window.getView();
-        window.setView(m_camera.getView());
+        auto defaultView = target.getView();
+        const float alpha = getGame().getInterpolationAlpha();
+        target.setView(m_camera.getInterpolatedView(alpha));
 
-        window.draw(m_backgroundSprite);
+        m_background.setTint(m_environment->getAmbientLightColor());
+        target.draw(m_background);
 
         // Draw environment
-        window.draw(*m_environment);
+        target.draw(*m_environment);
 
-        // Draw entities
-        std::for_each(m_entities.begin(), m_entities.end(),
-            [&window](const auto& entity) {
-                window.draw(*entity);
-            });
+        // Draw entities, bonus items and hazards, one batch per group
+        StateUtils::renderBatched(m_entities, target, m_spriteBatch, alpha);
+        StateUtils::renderBatched(m_bonusItems, target, m_spriteBatch, alpha);
+        StateUtils::renderBatched(m_hazards, target, m_spriteBatch, alpha);
 
-        // Draw bonus items
-        std::for_each(m_bonusItems.begin(), m_bonusItems.end(),
-            [&window](const auto& item) {
-                window.draw(*item);
-            });
-
-        // Draw hazards
-        std::for_each(m_hazards.begin(), m_hazards.end(),
-            [&window](const auto& hazard) {
-                window.draw(*hazard);
-            });
+        // Draw player - cast to renderable
+        sf::RenderStates playerStates;
+        playerStates.transform.translate(m_player->getInterpolatedPosition(alpha) - m_player->getPosition());
+        target.draw(static_cast<const Renderable&>(*m_player), playerStates);
 
-        // Draw player - cast to drawable
-        window.draw(static_cast<const sf::Drawable&>(*m_player));
-
-        window.setView(defaultView);
+        target.setView(defaultView);
 
         // Draw UI
-        window.draw(m_objectiveText);
-        window.draw(m_timerText);
-        window.draw(m_scoreText);
-        window.draw(m_timerBackground);
-        window.draw(m_timerBar);
+        target.draw(m_objectiveText);
+        target.draw(m_timerText);
+        target.draw(m_scoreText);
+        target.draw(m_timerBackground);
+        target.draw(m_timerBar);
 
         if (m_showInstructions)
-            window.draw(m_instructionText);
+            target.draw(m_instructionText);
 
         // Draw completion message
         if (m_stageComplete)
@@ -374,7 +376,7 @@ namespace FishGame
             completeText.setPosition(Constants::WINDOW_CENTER_X,
                 Constants::WINDOW_CENTER_Y);
 
-            window.draw(completeText);
+            target.draw(completeText);
         }
     }
 
@@ -423,10 +425,10 @@ namespace FishGame
 
         sf::FloatRect b = m_instructionText.getLocalBounds();
         m_instructionText.setOrigin(b.width / 2.f, b.height / 2.f);
-        auto win = getGame().getWindow().getSize();
+        auto win = getGame().getWindowSize();
         m_instructionText.setPosition(win.x / 2.f, win.y - 60.f);
 
-        updateCamera();
+        updateCamera(getGame().getTimePerTick());
     }
 
     void BonusStageState::onDeactivate()
@@ -544,8 +546,9 @@ namespace FishGame
         // Check if player got eaten
         std::for_each(m_entities.begin(), m_entities.end(),
             [this](auto& entity) {
-                if (Fish* fish = dynamic_cast<Fish*>(entity.get()))
+                if (isFishKind(entity->getKind()))
                 {
+                    auto* fish = static_cast<Fish*>(entity.get());
                     if (fish->canEat(*m_player) && CollisionDetector::checkCircleCollision(*m_player, *fish))
                     {
                         // Player dies - stage failed
@@ -571,7 +574,7 @@ namespace FishGame
         std::generate_n(std::back_inserter(m_bonusItems), 3, [this] {
             auto oyster = std::make_unique<PermanentOyster>();
             float x = m_xDist(m_randomEngine);
-            float y = static_cast<float>(getGame().getWindow().getSize().y) - 80.0f;
+            float y = static_cast<float>(getGame().getWindowSize().y) - 80.0f;
             oyster->setPosition(x, y);
             oyster->m_baseY = y;
             oyster->initializeSprites(getGame().getSpriteManager());
@@ -589,7 +592,7 @@ namespace FishGame
             float y = m_yDist(m_randomEngine);
             fish->setPosition(x, y);
             fish->setDirection(fromLeft ? 1.0f : -1.0f, 0.0f);
-            fish->setWindowBounds(getGame().getWindow().getSize());
+            fish->setWindowBounds(getGame().getWindowSize());
             fish->initializeSprite(getGame().getSpriteManager());
             return fish;
             });
@@ -604,7 +607,7 @@ namespace FishGame
             float x = Constants::WINDOW_CENTER_X + std::cos(angle) * 500.0f;
             float y = Constants::WINDOW_CENTER_Y + std::sin(angle) * 300.0f;
             barracuda->setPosition(x, y);
-            barracuda->setWindowBounds(getGame().getWindow().getSize());
+            barracuda->setWindowBounds(getGame().getWindowSize());
             barracuda->initializeSprite(getGame().getSpriteManager());
             ++i;
             return barracuda;
@@ -688,11 +691,27 @@ void BonusStageState::spawnBomb()
         return m_bonusScore;
     }
 
-    void BonusStageState::updateCamera()
+    void BonusStageState::updateCamera(sf::Time deltaTime)
     {
         if (!m_player)
             return;
 
-        m_camera.update(m_player->getPosition());
+        m_camera.update(m_player->getPosition(), deltaTime);
+    }
+
+    void BonusStageState::rebuildCollisionGrid()
+    {
+        m_collisionGrid.clear();
+        for (std::size_t i = 0; i < m_entities.size(); ++i)
+        {
+            if (m_entities[i] && m_entities[i]->isAlive())
+                m_collisionGrid.add(*m_entities[i], 0, static_cast<std::uint32_t>(i));
+        }
+        for (std::size_t i = 0; i < m_hazards.size(); ++i)
+        {
+            if (m_hazards[i] && m_hazards[i]->isAlive())
+                m_collisionGrid.add(*m_hazards[i], 1, static_cast<std::uint32_t>(i));
+        }
+        m_collisionGrid.build();
     }
 }
@@ -25,8 +25,8 @@ void EnvironmentController::updateEffectTimers(sf::Time dt)
         if (m_freezeTimer <= sf::Time::Zero) {
             m_isPlayerFrozen = false;
             EntityUtils::forEachAlive(m_entities, [](Entity& e) {
-                if (auto* f = dynamic_cast<Fish*>(&e))
-                    f->setFrozen(false);
+                if (isFishKind(e.getKind()))
+                    static_cast<Fish&>(e).setFrozen(false);
             });
         }
     }
@@ -52,8 +52,8 @@ void EnvironmentController::applyFreeze()
     m_freezeTimer = sf::seconds(5.f);
     m_soundPlayer.play(SoundEffectID::FreezePowerup);
     EntityUtils::forEachAlive(m_entities, [](Entity& e) {
-        if (auto* f = dynamic_cast<Fish*>(&e))
-            f->setFrozen(true);
+        if (isFishKind(e.getKind()))
+            static_cast<Fish&>(e).setFrozen(true);
     });
 }
 
@@ -2,61 +2,28 @@
 #include "Game.h"
 #include <algorithm>
 
-namespace {
-using FishGame::TextureID;
-sf::IntRect firstFrameRect(TextureID id) {
-  using namespace FishGame;
-  switch (id) {
-  case TextureID::SmallFish:
-  case TextureID::PoisonFish:
-  case TextureID::Angelfish:
-    return {1, 1, 66, 44};
-  case TextureID::MediumFish:
-    return {1, 1, 172, 108};
-  case TextureID::LargeFish:
-    return {1, 1, 201, 148};
-  case TextureID::PearlOysterClosed:
-    return {1, 1, 101, 101};
-  case TextureID::PearlOysterOpen:
-    return {1 + 4 * 101, 1, 101, 101};
-  case TextureID::Bomb:
-    return {1, 1, 69, 69};
-  case TextureID::Pufferfish:
-    return {5, 5, 187, 131};
-  case TextureID::PufferfishInflated:
-    return {5, 136, 186, 169};
-  case TextureID::Jellyfish:
-    return {1, 1, 75, 197};
-  case TextureID::Barracuda:
-    return {1, 1, 270, 122};
-  default:
-    return {};
-  }
-}
-} // namespace
-
 namespace FishGame {
 GameOptionsState::GameOptionsState(Game &game)
     : State(game), m_titleText(), m_instructionText(), m_gameDescriptionText(),
-      m_controlsText(), m_musicVolumeText(), m_soundVolumeText(),
+      m_controlsText(), m_musicVolumeText(), m_soundVolumeText(), m_tickRateText(),
       m_overlaySprite(), m_backButtonSprite(), m_nextButtonSprite(), m_backText(),
       m_nextText(), m_background() {}
 
 void GameOptionsState::onActivate() {
-  auto &window = getGame().getWindow();
+  const sf::Vector2u windowSize = getGame().getWindowSize();
   auto &font = getGame().getFonts().get(Fonts::Main);
   auto &manager = getGame().getSpriteManager();
 
   m_musicVolume = getGame().getMusicPlayer().getVolume();
   m_soundVolume = getGame().getSoundPlayer().getVolume();
 
-  m_background.setSize(sf::Vector2f(window.getSize()));
+  m_background.setSize(sf::Vector2f(windowSize));
   m_background.setFillColor(Constants::OVERLAY_COLOR);
 
   m_overlaySprite.setTexture(manager.getTexture(TextureID::StageIntro));
   auto size = m_overlaySprite.getTexture()->getSize();
-  m_overlaySprite.setScale(static_cast<float>(window.getSize().x) / size.x,
-                           static_cast<float>(window.getSize().y) / size.y);
+  m_overlaySprite.setScale(static_cast<float>(windowSize.x) / size.x,
+                           static_cast<float>(windowSize.y) / size.y);
 
   m_titleText.setFont(font);
   m_titleText.setString("OPTIONS");
@@ -64,8 +31,8 @@ void GameOptionsState::onActivate() {
   m_titleText.setFillColor(sf::Color::White);
   auto bounds = m_titleText.getLocalBounds();
   m_titleText.setOrigin(bounds.width / 2.f, bounds.height / 2.f);
-  float winWidth = static_cast<float>(window.getSize().x);
-  float winHeight = static_cast<float>(window.getSize().y);
+  float winWidth = static_cast<float>(windowSize.x);
+  float winHeight = static_cast<float>(windowSize.y);
   m_titleText.setPosition(winWidth / 2.f, 180.f);
 
   m_gameDescriptionText.setFont(font);
@@ -86,7 +53,8 @@ void GameOptionsState::onActivate() {
   m_controlsText.setPosition(winWidth / 2.f, 290.f);
 
   m_instructionText.setFont(font);
-  m_instructionText.setString("Use Arrows or drag bars to change volume");
+  m_instructionText.setString(
+      "Use Arrows or drag bars to change volume, T to change tick rate");
   m_instructionText.setCharacterSize(36);
   m_instructionText.setFillColor(sf::Color::White);
   bounds = m_instructionText.getLocalBounds();
@@ -101,6 +69,10 @@ void GameOptionsState::onActivate() {
   m_soundVolumeText.setCharacterSize(48);
   m_soundVolumeText.setFillColor(sf::Color::White);
 
+  m_tickRateText.setFont(font);
+  m_tickRateText.setCharacterSize(36);
+  m_tickRateText.setFillColor(sf::Color::White);
+
   // Setup volume bars
   constexpr float barWidth = 300.f;
   // Slightly thicker bar for better visibility
@@ -162,10 +134,31 @@ void GameOptionsState::onActivate() {
   updateCurrentInfo();
 
   updateVolumeTexts();
+  updateTickRateText();
+}
+
+void GameOptionsState::updateTickRateText() {
+  const sf::Vector2u windowSize = getGame().getWindowSize();
+  m_tickRateText.setString("Simulation Rate: " +
+                           std::to_string(getGame().getTickRate()) + " Hz");
+
+  auto tb = m_tickRateText.getLocalBounds();
+  m_tickRateText.setOrigin(tb.width / 2.f, tb.height / 2.f);
+  m_tickRateText.setPosition(static_cast<float>(windowSize.x) / 2.f,
+                             static_cast<float>(windowSize.y) / 2.f +
+                                 145.f);
+}
+
+void GameOptionsState::cycleTickRate() {
+  // Step to the next supported rate, wrapping back to the slowest
+  const auto &rates = Constants::TICK_RATE_OPTIONS;
+  auto next = std::upper_bound(rates.begin(), rates.end(), getGame().getTickRate());
+  getGame().setTickRate(next == rates.end() ? rates.front() : *next);
+  updateTickRateText();
 }
 
 void GameOptionsState::updateVolumeTexts() {
-  auto &window = getGame().getWindow();
+  const sf::Vector2u windowSize = getGame().getWindowSize();
   m_musicVolumeText.setString("Music Volume: " +
                               std::to_string(static_cast<int>(m_musicVolume)));
   m_soundVolumeText.setString("Sound Volume: " +
@@ -173,8 +166,8 @@ void GameOptionsState::updateVolumeTexts() {
 
   auto mb = m_musicVolumeText.getLocalBounds();
   m_musicVolumeText.setOrigin(mb.width / 2.f, mb.height / 2.f);
-  m_musicVolumeText.setPosition(static_cast<float>(window.getSize().x) / 2.f,
-                                static_cast<float>(window.getSize().y) / 2.f -
+  m_musicVolumeText.setPosition(static_cast<float>(windowSize.x) / 2.f,
+                                static_cast<float>(windowSize.y) / 2.f -
                                     40.f);
 
   // Add extra spacing between the volume text and its bar for clarity
@@ -187,8 +180,8 @@ void GameOptionsState::updateVolumeTexts() {
 
   auto sb = m_soundVolumeText.getLocalBounds();
   m_soundVolumeText.setOrigin(sb.width / 2.f, sb.height / 2.f);
-  m_soundVolumeText.setPosition(static_cast<float>(window.getSize().x) / 2.f,
-                                static_cast<float>(window.getSize().y) / 2.f +
+  m_soundVolumeText.setPosition(static_cast<float>(windowSize.x) / 2.f,
+                                static_cast<float>(windowSize.y) / 2.f +
                                     40.f);
 
   m_soundBar.setPosition(m_soundVolumeText.getPosition().x,
@@ -228,6 +221,10 @@ void GameOptionsState::handleEvent(const sf::Event &event) {
       sounds.setVolume(m_soundVolume);
       updateVolumeTexts();
       break;
+    case sf::Keyboard::T:
+      if (m_currentIndex == 0)
+        cycleTickRate();
+      break;
     default:
       break;
     }
@@ -284,6 +281,9 @@ void GameOptionsState::handleEvent(const sf::Event &event) {
       m_soundVolume = (rel / m_soundBar.getSize().x) * 100.f;
       sounds.setVolume(m_soundVolume);
       updateVolumeTexts();
+    } else if (m_currentIndex == 0 &&
+               m_tickRateText.getGlobalBounds().contains(pos)) {
+      cycleTickRate();
     } else if (m_backButtonSprite.getGlobalBounds().contains(pos)) {
       deferAction([this]() { requestStackPop(); });
     } else if (m_nextButtonSprite.getGlobalBounds().contains(pos)) {
@@ -303,31 +303,31 @@ bool GameOptionsState::update(sf::Time) {
   return false;
 }
 
-void GameOptionsState::render() {
-  auto &window = getGame().getWindow();
-  window.draw(m_background);
-  window.draw(m_overlaySprite);
-  window.draw(m_titleText);
-  window.draw(m_gameDescriptionText);
-  window.draw(m_controlsText);
+void GameOptionsState::render(DrawList& target) {
+  target.draw(m_background);
+  target.draw(m_overlaySprite);
+  target.draw(m_titleText);
+  target.draw(m_gameDescriptionText);
+  target.draw(m_controlsText);
   // Display volume controls only on the first page
   if (m_currentIndex == 0) {
-    window.draw(m_musicVolumeText);
-    window.draw(m_musicBar);
-    window.draw(m_musicKnob);
-    window.draw(m_soundVolumeText);
-    window.draw(m_soundBar);
-    window.draw(m_soundKnob);
-    window.draw(m_instructionText);
+    target.draw(m_musicVolumeText);
+    target.draw(m_musicBar);
+    target.draw(m_musicKnob);
+    target.draw(m_soundVolumeText);
+    target.draw(m_soundBar);
+    target.draw(m_soundKnob);
+    target.draw(m_tickRateText);
+    target.draw(m_instructionText);
   } else if (!m_infoItems.empty()) {
     auto &item = m_infoItems[m_currentIndex - 1];
-    window.draw(item.sprite);
-    window.draw(item.text);
+    target.draw(item.sprite);
+    target.draw(item.text);
   }
-  window.draw(m_backButtonSprite);
-  window.draw(m_backText);
-  window.draw(m_nextButtonSprite);
-  window.draw(m_nextText);
+  target.draw(m_backButtonSprite);
+  target.draw(m_backText);
+  target.draw(m_nextButtonSprite);
+  target.draw(m_nextText);
 }
 
 void GameOptionsState::setupInfoItems() {
@@ -370,12 +370,10 @@ void GameOptionsState::updateCurrentInfo() {
   if (m_infoItems.empty() || m_currentIndex == 0)
     return;
 
-  auto &window = getGame().getWindow();
+  const sf::Vector2u windowSize = getGame().getWindowSize();
   auto &item = m_infoItems[m_currentIndex - 1];
 
-  sf::IntRect rect = firstFrameRect(item.tex);
-  if (rect.width > 0)
-    item.sprite.setTextureRect(rect);
+  item.sprite.setTextureRect(getGame().getSpriteManager().getFirstFrameRect(item.tex));
 
   auto bounds = item.sprite.getLocalBounds();
   item.sprite.setOrigin(bounds.width / 2.f, bounds.height / 2.f);
@@ -383,8 +381,8 @@ void GameOptionsState::updateCurrentInfo() {
   // a larger scale
   constexpr float spriteScale = 1.2f;
   item.sprite.setScale(spriteScale, spriteScale);
-  item.sprite.setPosition(static_cast<float>(window.getSize().x) / 2.f,
-                          static_cast<float>(window.getSize().y) / 2.f + 60.f);
+  item.sprite.setPosition(static_cast<float>(windowSize.x) / 2.f,
+                          static_cast<float>(windowSize.y) / 2.f + 60.f);
 
   auto tb = item.text.getLocalBounds();
   item.text.setOrigin(tb.width / 2.f, tb.height / 2.f);
@@ -68,20 +68,18 @@ namespace FishGame
         return false; // Don't block updates to states below
     }
 
-    void GameOverState::render()
+    void GameOverState::render(DrawList& target)
     {
-        renderBackground();
-        renderParticles();
-        renderStats();
-        renderMenu();
+        renderBackground(target);
+        renderParticles(target);
+        renderStats(target);
+        renderMenu(target);
     }
 
     void GameOverState::initializeUI()
     {
-        auto& window = getGame().getWindow();
         auto& fonts = getGame().getFonts();
-        sf::Vector2f windowSize(static_cast<float>(window.getSize().x),
-            static_cast<float>(window.getSize().y));
+        const sf::Vector2f windowSize(getGame().getWindowSize());
 
         // Background overlay
         m_backgroundOverlay.setSize(windowSize);
@@ -113,7 +111,7 @@ namespace FishGame
     void GameOverState::initializeStats()
     {
         const auto& stats = GameStats::getInstance();
-        float startY = getGame().getWindow().getSize().y * 0.35f;
+        float startY = getGame().getWindowSize().y * 0.35f;
         float spacing = 40.0f;
 
         // Create stat display texts
@@ -133,8 +131,7 @@ namespace FishGame
     void GameOverState::initializeMenu()
     {
         auto& fonts = getGame().getFonts();
-        sf::Vector2f windowSize(static_cast<float>(getGame().getWindow().getSize().x),
-            static_cast<float>(getGame().getWindow().getSize().y));
+        const sf::Vector2f windowSize(getGame().getWindowSize());
         float menuStartY = windowSize.y * 0.65f;
         float spacing = 60.0f;
 
@@ -152,7 +149,7 @@ namespace FishGame
             }},
             {"Exit", [this]() {
                 m_isTransitioning = true;
-                getGame().getWindow().close();
+                requestStackClear();
             }}
         } };
 
@@ -288,7 +285,7 @@ namespace FishGame
         if (m_isTransitioning) return;
 
         // Get mouse position for hover effects
-        sf::Vector2i mousePos = sf::Mouse::getPosition(getGame().getWindow());
+        sf::Vector2i mousePos = getGame().getInputSnapshot().mousePosition;
         sf::Vector2f mousePosF(static_cast<float>(mousePos.x), static_cast<float>(mousePos.y));
 
         // Check hover using STL algorithms
@@ -414,51 +411,45 @@ namespace FishGame
         }
     }
 
-    void GameOverState::renderBackground()
+    void GameOverState::renderBackground(DrawList& target)
     {
-        auto& window = getGame().getWindow();
-        window.draw(m_backgroundOverlay);
+        target.draw(m_backgroundOverlay);
     }
 
-    void GameOverState::renderStats()
+    void GameOverState::renderStats(DrawList& target)
     {
-        auto& window = getGame().getWindow();
         const auto& stats = GameStats::getInstance();
 
-        window.draw(m_gameOverText);
+        target.draw(m_gameOverText);
 
         if (stats.newHighScore)
         {
-            window.draw(m_titleText);
+            target.draw(m_titleText);
         }
 
         // Render all stat texts using STL
         std::for_each(m_statTexts.begin(), m_statTexts.end(),
-            [&window](const auto& text) {
-                window.draw(text);
+            [&target](const auto& text) {
+                target.draw(text);
             });
     }
 
-    void GameOverState::renderMenu()
+    void GameOverState::renderMenu(DrawList& target)
     {
-        auto& window = getGame().getWindow();
-
         // Render menu items using STL
         std::for_each(m_menuItems.begin(), m_menuItems.end(),
-            [&window](const auto& item) {
-                window.draw(item.background);
-                window.draw(item.textObject);
+            [&target](const auto& item) {
+                target.draw(item.background);
+                target.draw(item.textObject);
             });
     }
 
-    void GameOverState::renderParticles()
+    void GameOverState::renderParticles(DrawList& target)
     {
-        auto& window = getGame().getWindow();
-
         // Render all particles using STL
         std::for_each(m_particles.begin(), m_particles.end(),
-            [&window](const auto& particle) {
-                window.draw(particle.shape);
+            [&target](const auto& particle) {
+                target.draw(particle.shape);
             });
     }
 
@@ -466,7 +457,7 @@ namespace FishGame
     {
         sf::FloatRect bounds = text.getLocalBounds();
         text.setOrigin(bounds.left + bounds.width * 0.5f, bounds.top + bounds.height * 0.5f);
-        text.setPosition(static_cast<float>(getGame().getWindow().getSize().x) * 0.5f, yPosition);
+        text.setPosition(static_cast<float>(getGame().getWindowSize().x) * 0.5f, yPosition);
     }
 
     sf::Color GameOverState::interpolateColor(const sf::Color& start, const sf::Color& end, float t)
@@ -6,15 +6,7 @@ namespace FishGame {
 HUDController::HUDController(const sf::Font& font, const sf::Vector2u& size)
     : m_hud(std::make_unique<HUDSystem>(font, size)) {}
 
-void HUDController::update(sf::Time dt,
-                           int score,
-                           int lives,
-                           int level,
-                           int chainBonus,
-                           const std::vector<PowerUpType>& active,
-                           bool frozen, sf::Time freeze,
-                           bool reversed, sf::Time reverse,
-                           bool stunned, sf::Time stun)
+void HUDController::update(sf::Time dt, const HUDState& state)
 {
     m_frameCount++;
     m_fpsUpdate += dt;
@@ -24,8 +16,7 @@ void HUDController::update(sf::Time dt,
         m_fpsUpdate = sf::Time::Zero;
     }
 
-    m_hud->update(score, lives, level, chainBonus, active,
-                  frozen, freeze, reversed, reverse, stunned, stun, m_currentFPS);
+    m_hud->update(state);
 }
 
 } // namespace FishGame
@@ -11,30 +11,30 @@ HighScoresState::HighScoresState(Game& game)
 void HighScoresState::onActivate() {
     auto& fonts = getGame().getFonts();
     auto& manager = getGame().getSpriteManager();
-    auto& window = getGame().getWindow();
+    const sf::Vector2u windowSize = getGame().getWindowSize();
 
     m_backgroundSprite.setTexture(manager.getTexture(TextureID::Background1));
     auto size = m_backgroundSprite.getTexture()->getSize();
-    m_backgroundSprite.setScale(static_cast<float>(window.getSize().x)/size.x,
-                               static_cast<float>(window.getSize().y)/size.y);
+    m_backgroundSprite.setScale(static_cast<float>(windowSize.x)/size.x,
+                               static_cast<float>(windowSize.y)/size.y);
 
     m_overlaySprite.setTexture(manager.getTexture(TextureID::StageIntro));
     size = m_overlaySprite.getTexture()->getSize();
-    m_overlaySprite.setScale(static_cast<float>(window.getSize().x)/size.x,
-                             static_cast<float>(window.getSize().y)/size.y);
+    m_overlaySprite.setScale(static_cast<float>(windowSize.x)/size.x,
+                             static_cast<float>(windowSize.y)/size.y);
 
     m_titleText.setFont(fonts.get(Fonts::Main));
     m_titleText.setString("HIGH SCORES");
     m_titleText.setCharacterSize(48);
     auto tb = m_titleText.getLocalBounds();
     m_titleText.setOrigin(tb.width/2.f, tb.height/2.f);
-    m_titleText.setPosition(window.getSize().x/2.f, 150.f);
+    m_titleText.setPosition(windowSize.x/2.f, 150.f);
 
     m_backButton.setTexture(manager.getTexture(TextureID::Button));
     auto bb = m_backButton.getLocalBounds();
     m_backButton.setOrigin(bb.width/2.f, bb.height/2.f);
     m_backButton.setScale(Constants::MENU_BUTTON_SCALE, Constants::MENU_BUTTON_SCALE);
-    m_backButton.setPosition(window.getSize().x/2.f, window.getSize().y - 120.f);
+    m_backButton.setPosition(windowSize.x/2.f, windowSize.y - 120.f);
 
     m_backText.setFont(fonts.get(Fonts::Main));
     m_backText.setString("BACK");
@@ -79,7 +79,7 @@ void HighScoresState::loadScores() {
         text.setCharacterSize(32);
         auto b = text.getLocalBounds();
         text.setOrigin(b.width/2.f, b.height/2.f);
-        text.setPosition(getGame().getWindow().getSize().x/2.f, startY + spacing*i);
+        text.setPosition(getGame().getWindowSize().x/2.f, startY + spacing*i);
         m_scoreTexts.push_back(text);
     }
 }
@@ -106,14 +106,13 @@ bool HighScoresState::update(sf::Time) {
     return false;
 }
 
-void HighScoresState::render() {
-    auto& window = getGame().getWindow();
-    window.draw(m_backgroundSprite);
-    window.draw(m_overlaySprite);
-    window.draw(m_titleText);
-    for(const auto& t : m_scoreTexts) window.draw(t);
-    window.draw(m_backButton);
-    window.draw(m_backText);
+void HighScoresState::render(DrawList& target) {
+    target.draw(m_backgroundSprite);
+    target.draw(m_overlaySprite);
+    target.draw(m_titleText);
+    for(const auto& t : m_scoreTexts) target.draw(t);
+    target.draw(m_backButton);
+    target.draw(m_backText);
 }
 
 } // namespace FishGame
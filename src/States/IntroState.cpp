@@ -16,7 +16,7 @@ namespace FishGame
 
     void IntroState::onActivate()
     {
-        auto& window = getGame().getWindow();
+        const sf::Vector2u windowSize = getGame().getWindowSize();
         auto& manager = getGame().getSpriteManager();
         m_sprites[0].setTexture(manager.getTexture(TextureID::Intro1));
         m_sprites[1].setTexture(manager.getTexture(TextureID::Intro2));
@@ -25,8 +25,8 @@ namespace FishGame
         {
             auto size = sprite.getTexture()->getSize();
             sprite.setScale(
-                static_cast<float>(window.getSize().x) / size.x,
-                static_cast<float>(window.getSize().y) / size.y);
+                static_cast<float>(windowSize.x) / size.x,
+                static_cast<float>(windowSize.y) / size.y);
         });
 
         m_currentIndex = 0;
@@ -101,12 +101,11 @@ namespace FishGame
         return false;
     }
 
-    void IntroState::render()
+    void IntroState::render(DrawList& target)
     {
-        auto& window = getGame().getWindow();
         if (m_currentIndex < m_sprites.size())
-            window.draw(m_sprites[m_currentIndex]);
+            target.draw(m_sprites[m_currentIndex]);
         if (m_isFading && m_currentIndex + 1 < m_sprites.size())
-            window.draw(m_sprites[m_currentIndex + 1]);
+            target.draw(m_sprites[m_currentIndex + 1]);
     }
 }
@@ -29,7 +29,7 @@ namespace FishGame
 
     void MenuState::initializeMenu()
     {
-        auto& window = getGame().getWindow();
+        const sf::Vector2u windowSize = getGame().getWindowSize();
         // Setup title sprite
         m_titleSprite.setTexture(
             getGame().getSpriteManager().getTexture(TextureID::GameTitle));
@@ -39,7 +39,7 @@ namespace FishGame
         // Center title sprite
         sf::FloatRect titleBounds = m_titleSprite.getLocalBounds();
         m_titleSprite.setOrigin(titleBounds.width / 2.0f, titleBounds.height / 2.0f);
-        m_titleSprite.setPosition(window.getSize().x / 2.0f, Constants::TITLE_Y_POSITION);
+        m_titleSprite.setPosition(windowSize.x / 2.0f, Constants::TITLE_Y_POSITION);
 
         // Initialize menu items
         const std::array<std::tuple<TextureID, TextureID, MenuAction>, static_cast<size_t>(MenuOption::Count)> menuData = { {
@@ -72,7 +72,7 @@ namespace FishGame
         size_t index = 0;
 
         std::transform(menuData.begin(), menuData.end(), m_menuItems.begin(),
-            [this, &window, &yPosition, &index](const auto& data) -> MenuItemType {
+            [this, windowSize, &yPosition, &index](const auto& data) -> MenuItemType {
                 MenuItemType item;
                 item.normalTexture = std::get<0>(data);
                 item.hoverTexture = std::get<1>(data);
@@ -85,11 +85,11 @@ namespace FishGame
 
                 sf::FloatRect scaledBounds = item.sprite.getGlobalBounds();
                 if (index == static_cast<size_t>(MenuOption::Exit)) {
-                    float xPos = static_cast<float>(window.getSize().x) - Constants::HUD_MARGIN - scaledBounds.width / 2.0f;
-                    float yPos = static_cast<float>(window.getSize().y) - Constants::HUD_MARGIN - scaledBounds.height / 2.0f;
+                    float xPos = static_cast<float>(windowSize.x) - Constants::HUD_MARGIN - scaledBounds.width / 2.0f;
+                    float yPos = static_cast<float>(windowSize.y) - Constants::HUD_MARGIN - scaledBounds.height / 2.0f;
                     item.sprite.setPosition(xPos, yPos);
                 } else {
-                    item.sprite.setPosition(window.getSize().x / 2.0f, yPosition);
+                    item.sprite.setPosition(windowSize.x / 2.0f, yPosition);
                     yPosition += Constants::MENU_ITEM_SPACING;
                 }
 
@@ -102,11 +102,10 @@ namespace FishGame
 
     void MenuState::initializeBackground()
     {
-        auto& window = getGame().getWindow();
         m_backgroundSprite.setTexture(
             getGame().getSpriteManager().getTexture(TextureID::Background1));
 
-        sf::Vector2f windowSize(window.getSize());
+        sf::Vector2f windowSize(getGame().getWindowSize());
         sf::Vector2f texSize(m_backgroundSprite.getTexture()->getSize());
         m_backgroundSprite.setScale(windowSize.x / texSize.x,
             windowSize.y / texSize.y);
@@ -283,26 +282,24 @@ namespace FishGame
         }
     }
 
-    void MenuState::render()
+    void MenuState::render(DrawList& target)
     {
-        auto& window = getGame().getWindow();
-
-        window.draw(m_backgroundSprite);
+        target.draw(m_backgroundSprite);
         for (const auto& fish : m_backgroundFish)
-            window.draw(fish.shape);
+            target.draw(fish.shape);
 
-        window.draw(m_titleSprite);
+        target.draw(m_titleSprite);
 
         // Render all menu items
         std::for_each(m_menuItems.begin(), m_menuItems.end(),
-            [&window](const auto& item) {
-                window.draw(item.sprite);
+            [&target](const auto& item) {
+                target.draw(item.sprite);
             });
     }
 
     void MenuState::updateBackground(sf::Time deltaTime)
     {
-        auto size = getGame().getWindow().getSize();
+        auto size = getGame().getWindowSize();
 
         std::for_each(m_backgroundFish.begin(), m_backgroundFish.end(),
             [&](BackgroundFish& fish) {
@@ -18,7 +18,7 @@ namespace FishGame
     PlayState::PlayState(Game& game)
         : State(game)
         , m_player(std::make_unique<Player>())
-        , m_fishSpawner(std::make_unique<EnhancedFishSpawner>(getGame().getWindow().getSize(), getGame().getSpriteManager()))
+        , m_fishSpawner(std::make_unique<EnhancedFishSpawner>(getGame().getWindowSize(), getGame().getSpriteManager()))
         , m_schoolingSystem(std::make_unique<SchoolingSystem>())
         , m_entities()
         , m_bonusItems()
@@ -48,6 +48,7 @@ namespace FishGame
     {
         initializeSystems();
         m_player->setSoundPlayer(&getGame().getSoundPlayer());
+        m_player->setInputSource(&getGame().getInputSnapshot());
         if (m_frenzySystem)
             m_frenzySystem->setSoundPlayer(&getGame().getSoundPlayer());
 
@@ -57,12 +58,11 @@ namespace FishGame
         m_hazards.reserve(20);
 
         // Setup background and camera
-        auto& window = getGame().getWindow();
         updateBackground(m_gameState.currentLevel);
 
-        const sf::Vector2f windowSize(window.getSize());
+        const sf::Vector2f windowSize(getGame().getWindowSize());
 
-        sf::View view = window.getDefaultView();
+        sf::View view(sf::FloatRect(0.f, 0.f, windowSize.x, windowSize.y));
         view.zoom(Constants::CAMERA_ZOOM_FACTOR);
         view.setCenter(windowSize * 0.5f);
         m_camera = CameraController(view, windowSize);
@@ -72,11 +72,11 @@ namespace FishGame
 
     void PlayState::initializeSystems()
     {
-        auto& window = getGame().getWindow();
+        const sf::Vector2u windowSize = getGame().getWindowSize();
         auto& font = getGame().getFonts().get(Fonts::Main);
 
         // Create game systems through helper
-        m_systems.initialize(font, window.getSize(), getGame().getSpriteManager());
+        m_systems.initialize(font, windowSize, getGame().getSpriteManager());
 
         // Cache raw pointers for convenience
         m_growthMeter = &m_systems.getGrowthMeter();
@@ -89,9 +89,10 @@ namespace FishGame
         // Initialize environment system
         m_environmentSystem->setEnvironment(EnvironmentType::OpenOcean);
         m_environmentSystem->pauseDayNightCycle();
+        m_environmentSystem->setLightingOverlayEnabled(false);
 
         // Initialize player with systems
-        m_player->setWindowBounds(window.getSize());
+        m_player->setWindowBounds(windowSize);
         m_player->initializeSystems(m_growthMeter, m_frenzySystem, m_powerUpManager, m_scoreSystem);
         m_player->initializeSprite(getGame().getSpriteManager());
 
@@ -109,13 +110,13 @@ namespace FishGame
         m_fishSpawner->setSpecialFishConfig(specialConfig);
 
         // Position UI elements
-        float growthMeterX = window.getSize().x - Constants::HUD_MARGIN - 300.0f;
+        float growthMeterX = windowSize.x - Constants::HUD_MARGIN - 300.0f;
         float growthMeterY = Constants::HUD_MARGIN + 20.0f;
         m_growthMeter->setPosition(growthMeterX, growthMeterY);
-        m_frenzySystem->setPosition(window.getSize().x / 2.0f, Constants::FRENZY_Y_POSITION);
+        m_frenzySystem->setPosition(windowSize.x / 2.0f, Constants::FRENZY_Y_POSITION);
 
         // Initialize controllers
-        m_hudController = std::make_unique<HUDController>(font, window.getSize());
+        m_hudController = std::make_unique<HUDController>(font, windowSize);
         m_environmentController = std::make_unique<EnvironmentController>(
             *m_environmentSystem, *m_player, m_entities, getGame().getSoundPlayer());
         m_spawnController = std::make_unique<SpawnController>(
@@ -152,6 +153,16 @@ namespace FishGame
 
 bool PlayState::update(sf::Time deltaTime)
 {
+    // Snapshot transforms so render() can blend toward this tick's result;
+    // ticks that move nothing (pause, transitions) then hold still
+    const auto storePrevious = [](Entity& entity) { entity.storePreviousPosition(); };
+    StateUtils::applyToEntities(m_entities, storePrevious);
+    StateUtils::applyToEntities(m_hazards, storePrevious);
+    StateUtils::applyToEntities(m_bonusItems, storePrevious);
+    if (m_player)
+        m_player->storePreviousPosition();
+    m_camera.storePreviousCenter();
+
     if (m_logic)
         return m_logic->update(deltaTime);
     return false;
@@ -171,20 +182,25 @@ void PlayState::updateGameplay(sf::Time deltaTime)
             m_spawnController->update(deltaTime, m_gameState.currentLevel);
 
         m_collisionSystem->process(*m_player, m_entities, m_bonusItems, m_hazards,
-            m_oysterManager, m_gameState.currentLevel);
+            m_oysterManager, m_gameState.currentLevel, deltaTime);
 
-        auto active = m_powerUpManager->getActivePowerUps();
         if (m_environmentController && m_hudController)
-            m_hudController->update(deltaTime,
-                m_scoreSystem->getCurrentScore(),
-                m_gameState.playerLives,
-                m_gameState.currentLevel,
-                m_scoreSystem->getChainBonus(),
-                active,
-                m_environmentController->isPlayerFrozen(), m_environmentController->getFreezeTimer(),
-                m_environmentController->hasControlsReversed(), m_environmentController->getControlReverseTimer(),
-                m_environmentController->isPlayerStunned(), m_environmentController->getStunTimer());
-    updateCamera();
+        {
+            HUDState hud;
+            hud.score = m_scoreSystem->getCurrentScore();
+            hud.lives = m_gameState.playerLives;
+            hud.level = m_gameState.currentLevel;
+            hud.chainBonus = m_scoreSystem->getChainBonus();
+            hud.activePowerUps = m_powerUpManager->getActiveMask();
+            hud.frozen = m_environmentController->isPlayerFrozen();
+            hud.freezeTime = m_environmentController->getFreezeTimer();
+            hud.reversed = m_environmentController->hasControlsReversed();
+            hud.reverseTime = m_environmentController->getControlReverseTimer();
+            hud.stunned = m_environmentController->isPlayerStunned();
+            hud.stunTime = m_environmentController->getStunTimer();
+            m_hudController->update(deltaTime, hud);
+        }
+    updateCamera(deltaTime);
 }
 
 void PlayState::updateRespawn(sf::Time deltaTime)
@@ -274,20 +290,16 @@ void PlayState::updateGameState(sf::Time deltaTime)
 
     void PlayState::updateEntities(sf::Time deltaTime)
     {
+        StateUtils::assignAnimationDetail(m_entities, m_camera.getView());
+        StateUtils::assignAnimationDetail(m_hazards, m_camera.getView());
+
         StateUtils::updateEntities(m_entities, deltaTime);
         StateUtils::updateEntities(m_bonusItems, deltaTime);
         StateUtils::updateEntities(m_hazards, deltaTime);
 
-        // Apply specific AI updates
-    EntityUtils::forEachAlive(m_entities, [this, deltaTime](Entity& entity) {
-        if (auto* fish = dynamic_cast<Fish*>(&entity))
-        {
-            if (!fish->isStunned())
-            {
-                fish->updateAI(m_entities, m_player.get(), deltaTime);
-            }
-        }
-    });
+        // Plan AI against a snapshot, then apply
+        m_aiSystem.setCameraFocus(m_camera.getView().getCenter());
+        m_aiSystem.update(m_entities, m_player.get(), deltaTime);
 
     m_particleSystem->update(deltaTime);
 
@@ -399,9 +411,9 @@ void PlayState::updateGameState(sf::Time deltaTime)
     void PlayState::makeAllEnemiesFlee()
     {
         EntityUtils::forEachAlive(m_entities, [](Entity& entity) {
-            if (auto* fish = dynamic_cast<Fish*>(&entity))
+            if (isFishKind(entity.getKind()))
             {
-                fish->startFleeing();
+                static_cast<Fish&>(entity).startFleeing();
             }
         });
     }
@@ -410,7 +422,7 @@ void PlayState::updateGameState(sf::Time deltaTime)
     {
         return std::none_of(m_entities.begin(), m_entities.end(),
             [](const auto& entity) {
-                return entity->isAlive() && dynamic_cast<const Fish*>(entity.get()) != nullptr;
+                return entity->isAlive() && isFishKind(entity->getKind());
             });
     }
 
@@ -481,6 +493,7 @@ void PlayState::updateGameState(sf::Time deltaTime)
         // Start player in the middle of the world
         m_player->setPosition(m_camera.getWorldSize() * 0.5f);
         m_camera.getView().setCenter(m_player->getPosition());
+        m_camera.storePreviousCenter();
 
         m_gameState.levelComplete = false;
         m_gameState.gameWon = false;
@@ -568,12 +581,12 @@ void PlayState::updateGameState(sf::Time deltaTime)
         m_particleSystem->createEffect(position, color, count);
     }
 
-    void PlayState::updateCamera()
+    void PlayState::updateCamera(sf::Time deltaTime)
     {
         if (!m_player)
             return;
 
-        m_camera.update(m_player->getPosition());
+        m_camera.update(m_player->getPosition(), deltaTime);
     }
 
     void PlayState::showMessage(const std::string& message)
@@ -582,44 +595,47 @@ void PlayState::updateGameState(sf::Time deltaTime)
             m_hudController->showMessage(message);
     }
 
-    void PlayState::render()
+    void PlayState::render(DrawList& target)
     {
-        auto& window = getGame().getWindow();
-        auto defaultView = window.getView();
-        window.setView(m_camera.getView());
+        auto defaultView = target.getView();
+        const float alpha = getGame().getInterpolationAlpha();
+        target.setView(m_camera.getInterpolatedView(alpha));
 
-        window.draw(m_backgroundSprite);
-        window.draw(*m_environmentSystem);
+        m_background.setTint(m_environmentSystem->getAmbientLightColor());
+        target.draw(m_background);
+        target.draw(*m_environmentSystem);
 
         if (m_gameState.currentLevel >= 2)
-            m_oysterManager->draw(window);
+            m_oysterManager->draw(target, m_spriteBatch);
 
-        StateUtils::renderContainer(m_hazards, window);
-        StateUtils::renderContainer(m_entities, window);
+        StateUtils::renderBatched(m_hazards, target, m_spriteBatch, alpha);
+        StateUtils::renderBatched(m_entities, target, m_spriteBatch, alpha);
 
-        StateUtils::renderContainer(m_bonusItems, window);
+        StateUtils::renderBatched(m_bonusItems, target, m_spriteBatch, alpha);
 
-        window.draw(*m_player);
+        sf::RenderStates playerStates;
+        playerStates.transform.translate(m_player->getInterpolatedPosition(alpha) - m_player->getPosition());
+        target.draw(*m_player, playerStates);
 
-        window.draw(*m_particleSystem);
+        target.draw(*m_particleSystem);
 
-        m_scoreSystem->drawFloatingScores(window);
+        m_scoreSystem->drawFloatingScores(target);
         
-        window.setView(defaultView);
-        window.draw(*m_growthMeter);
-        window.draw(*m_frenzySystem);
+        target.setView(defaultView);
+        target.draw(*m_growthMeter);
+        target.draw(*m_frenzySystem);
 
 
 
         // Render HUD
         if (m_hudController)
-            window.draw(m_hudController->getSystem());
+            target.draw(m_hudController->getSystem());
 
         if (m_gameState.gameWon || m_gameState.levelComplete)
         {
-            sf::RectangleShape overlay(sf::Vector2f(window.getSize()));
+            sf::RectangleShape overlay(sf::Vector2f(target.getSize()));
             overlay.setFillColor(Constants::OVERLAY_COLOR);
-            window.draw(overlay);
+            target.draw(overlay);
             // message rendered via HUD system
         }
     }
@@ -668,13 +684,13 @@ void PlayState::updateGameState(sf::Time deltaTime)
         }
 
         // Ensure camera starts centered on the player
-        updateCamera();
+        updateCamera(getGame().getTimePerTick());
     }
 
     void PlayState::onDeactivate()
     {
         // Show mouse cursor again when leaving play state
-        getGame().getWindow().setMouseCursorVisible(true);
+        getGame().setMouseCursorVisible(true);
     }
 
     static MusicID musicForLevel(int level)
@@ -702,12 +718,6 @@ void PlayState::updateGameState(sf::Time deltaTime)
         TextureID id = backgrounds[index];
 
         auto& manager = getGame().getSpriteManager();
-        m_backgroundSprite.setTexture(manager.getTexture(id));
-
-        auto windowSize = getGame().getWindow().getSize();
-        auto texSize = m_backgroundSprite.getTexture()->getSize();
-        m_backgroundSprite.setScale(
-            static_cast<float>(windowSize.x) / texSize.x,
-            static_cast<float>(windowSize.y) / texSize.y);
+        m_background.setTexture(manager.getTexture(id), getGame().getWindowSize());
     }
 }
@@ -9,29 +9,29 @@ PlayerNameState::PlayerNameState(Game& game)
 
 void PlayerNameState::onActivate(){
     auto& font = getGame().getFonts().get(Fonts::Main);
-    auto& window = getGame().getWindow();
+    const sf::Vector2u windowSize = getGame().getWindowSize();
     auto& manager = getGame().getSpriteManager();
     m_input.clear();
 
     m_backgroundSprite.setTexture(manager.getTexture(TextureID::Background1));
     auto size = m_backgroundSprite.getTexture()->getSize();
-    m_backgroundSprite.setScale(static_cast<float>(window.getSize().x)/size.x,
-                               static_cast<float>(window.getSize().y)/size.y);
+    m_backgroundSprite.setScale(static_cast<float>(windowSize.x)/size.x,
+                               static_cast<float>(windowSize.y)/size.y);
 
     m_overlaySprite.setTexture(manager.getTexture(TextureID::StageIntro));
     size = m_overlaySprite.getTexture()->getSize();
-    m_overlaySprite.setScale(static_cast<float>(window.getSize().x)/size.x,
-                             static_cast<float>(window.getSize().y)/size.y);
+    m_overlaySprite.setScale(static_cast<float>(windowSize.x)/size.x,
+                             static_cast<float>(windowSize.y)/size.y);
     m_prompt.setFont(font);
     m_prompt.setString("Enter Name:");
     m_prompt.setCharacterSize(36);
     auto pb=m_prompt.getLocalBounds();
     m_prompt.setOrigin(pb.width/2.f, pb.height/2.f);
-    m_prompt.setPosition(window.getSize().x/2.f, window.getSize().y/2.f - 40.f);
+    m_prompt.setPosition(windowSize.x/2.f, windowSize.y/2.f - 40.f);
 
     m_inputText.setFont(font);
     m_inputText.setCharacterSize(36);
-    m_inputText.setPosition(window.getSize().x/2.f, window.getSize().y/2.f + 10.f);
+    m_inputText.setPosition(windowSize.x/2.f, windowSize.y/2.f + 10.f);
     m_inputText.setOrigin(0.f, m_inputText.getLocalBounds().height/2.f);
 }
 
@@ -53,12 +53,11 @@ void PlayerNameState::handleEvent(const sf::Event& event){
 
 bool PlayerNameState::update(sf::Time){ processDeferredActions(); return false; }
 
-void PlayerNameState::render(){
-    auto& window=getGame().getWindow();
-    window.draw(m_backgroundSprite);
-    window.draw(m_overlaySprite);
-    window.draw(m_prompt);
-    window.draw(m_inputText);
+void PlayerNameState::render(DrawList& target){
+    target.draw(m_backgroundSprite);
+    target.draw(m_overlaySprite);
+    target.draw(m_prompt);
+    target.draw(m_inputText);
 }
 
 } // namespace FishGame
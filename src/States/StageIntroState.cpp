@@ -15,36 +15,6 @@ FishGame::TextureID backgroundForLevel(int level) {
   int index = ((level - 1) / 2) % 5;
   return backgrounds[index];
 }
-
-sf::IntRect firstFrameRect(FishGame::TextureID id) {
-  using namespace FishGame;
-  switch (id) {
-  case TextureID::SmallFish:
-  case TextureID::PoisonFish:
-  case TextureID::Angelfish:
-    return {1, 1, 66, 44};
-  case TextureID::MediumFish:
-    return {1, 1, 172, 108};
-  case TextureID::LargeFish:
-    return {1, 1, 201, 148};
-  case TextureID::PearlOysterClosed:
-    return {1, 1, 101, 101};
-  case TextureID::PearlOysterOpen:
-    return {1 + 4 * 101, 1, 101, 101};
-  case TextureID::Bomb:
-    return {1, 1, 69, 69};
-  case TextureID::Pufferfish:
-    return {5, 5, 187, 131};
-  case TextureID::PufferfishInflated:
-    return {5, 136, 186, 169};
-  case TextureID::Jellyfish:
-    return {1, 1, 75, 197};
-  case TextureID::Barracuda:
-    return {1, 1, 270, 122};
-  default:
-    return {};
-  }
-}
 } // namespace
 
 namespace FishGame {
@@ -65,28 +35,28 @@ void StageIntroState::onActivate() {
   getGame().getMusicPlayer().play(MusicID::InstructionsHelp, false);
   getGame().getSoundPlayer().play(SoundEffectID::StageIntro);
   auto &manager = getGame().getSpriteManager();
-  auto &window = getGame().getWindow();
+  const sf::Vector2u windowSize = getGame().getWindowSize();
   auto &font = getGame().getFonts().get(Fonts::Main);
   m_backgroundSprite.setTexture(
       manager.getTexture(backgroundForLevel(m_level)));
   auto texSize = m_backgroundSprite.getTexture()->getSize();
   m_backgroundSprite.setScale(
-      static_cast<float>(window.getSize().x) / texSize.x,
-      static_cast<float>(window.getSize().y) / texSize.y);
+      static_cast<float>(windowSize.x) / texSize.x,
+      static_cast<float>(windowSize.y) / texSize.y);
 
   m_overlaySprite.setTexture(manager.getTexture(TextureID::StageIntro));
   auto overlaySize = m_overlaySprite.getTexture()->getSize();
   m_overlaySprite.setScale(
-      static_cast<float>(window.getSize().x) / overlaySize.x,
-      static_cast<float>(window.getSize().y) / overlaySize.y);
+      static_cast<float>(windowSize.x) / overlaySize.x,
+      static_cast<float>(windowSize.y) / overlaySize.y);
 
   setupItems();
   m_nextButtonSprite.setTexture(manager.getTexture(TextureID::Button));
   auto b = m_nextButtonSprite.getLocalBounds();
   m_nextButtonSprite.setOrigin(b.width / 2.f, b.height / 2.f);
   m_nextButtonSprite.setScale(Constants::MENU_BUTTON_SCALE, Constants::MENU_BUTTON_SCALE);
-  m_nextButtonSprite.setPosition(window.getSize().x / 2.f,
-                                 window.getSize().y - Constants::STAGE_INTRO_NEXT_BUTTON_OFFSET);
+  m_nextButtonSprite.setPosition(windowSize.x / 2.f,
+                                 windowSize.y - Constants::STAGE_INTRO_NEXT_BUTTON_OFFSET);
 
   m_nextText.setFont(font);
   m_nextText.setString("NEXT");
@@ -166,9 +136,7 @@ void StageIntroState::setupItems() {
   float xText = Constants::STAGE_INTRO_TEXT_X;
   std::for_each(m_items.begin(), m_items.end(),
       [&, i = std::size_t{0}](Item &item) mutable {
-        sf::IntRect rect = firstFrameRect(item.tex);
-        if (rect.width > 0)
-          item.sprite.setTextureRect(rect);
+        item.sprite.setTextureRect(manager.getFirstFrameRect(item.tex));
 
         sf::FloatRect b = item.sprite.getLocalBounds();
         item.sprite.setOrigin(b.width / 2.f, b.height / 2.f);
@@ -215,15 +183,14 @@ void StageIntroState::exitState() {
   });
 }
 
-void StageIntroState::render() {
-  auto &window = getGame().getWindow();
-  window.draw(m_backgroundSprite);
-  window.draw(m_overlaySprite);
+void StageIntroState::render(DrawList& target) {
+  target.draw(m_backgroundSprite);
+  target.draw(m_overlaySprite);
   for (auto &item : m_items) {
-    window.draw(item.sprite);
-    window.draw(item.text);
+    target.draw(item.sprite);
+    target.draw(item.text);
   }
-  window.draw(m_nextButtonSprite);
-  window.draw(m_nextText);
+  target.draw(m_nextButtonSprite);
+  target.draw(m_nextText);
 }
 } // namespace FishGame
@@ -4,40 +4,6 @@
 #include "StageIntroState.h"
 #include <algorithm>
 
-namespace {
-using FishGame::TextureID;
-
-sf::IntRect firstFrameRect(TextureID id) {
-    using namespace FishGame;
-    switch (id) {
-    case TextureID::SmallFish:
-    case TextureID::PoisonFish:
-    case TextureID::Angelfish:
-        return {1,1,66,44};
-    case TextureID::MediumFish:
-        return {1,1,172,108};
-    case TextureID::LargeFish:
-        return {1,1,201,148};
-    case TextureID::PearlOysterClosed:
-        return {1,1,101,101};
-    case TextureID::PearlOysterOpen:
-        return {1+4*101,1,101,101};
-    case TextureID::Bomb:
-        return {1,1,69,69};
-    case TextureID::Pufferfish:
-        return {5,5,187,131};
-    case TextureID::PufferfishInflated:
-        return {5,136,186,169};
-    case TextureID::Jellyfish:
-        return {1,1,75,197};
-    case TextureID::Barracuda:
-        return {1,1,270,122};
-    default:
-        return {};
-    }
-}
-}
-
 namespace FishGame {
 StageSummaryState::StageSummaryState(Game& game)
     : State(game), m_overlaySprite(), m_scoreText(), m_nextButtonSprite(), m_nextText(), m_items() {}
@@ -55,11 +21,11 @@ void StageSummaryState::configure(int nextLevel, int levelScore,
 void StageSummaryState::onActivate() {
     getGame().getMusicPlayer().play(MusicID::ScoreSummary, false);
     auto& manager = getGame().getSpriteManager();
-    auto& window = getGame().getWindow();
+    const sf::Vector2u windowSize = getGame().getWindowSize();
     m_overlaySprite.setTexture(manager.getTexture(TextureID::StageIntro));
     auto size = m_overlaySprite.getTexture()->getSize();
-    m_overlaySprite.setScale(static_cast<float>(window.getSize().x)/size.x,
-                             static_cast<float>(window.getSize().y)/size.y);
+    m_overlaySprite.setScale(static_cast<float>(windowSize.x)/size.x,
+                             static_cast<float>(windowSize.y)/size.y);
 
     auto& font = getGame().getFonts().get(Fonts::Main);
     m_scoreText.setFont(font);
@@ -68,15 +34,15 @@ void StageSummaryState::onActivate() {
     m_scoreText.setString("Score: " + std::to_string(StageSummaryConfig::getInstance().levelScore));
     auto bounds = m_scoreText.getLocalBounds();
     m_scoreText.setOrigin(bounds.width/2.f, bounds.height/2.f);
-    m_scoreText.setPosition(window.getSize().x/2.f,
+    m_scoreText.setPosition(windowSize.x/2.f,
                             Constants::STAGE_SUMMARY_SCORE_Y);
 
     m_nextButtonSprite.setTexture(manager.getTexture(TextureID::Button));
     auto b = m_nextButtonSprite.getLocalBounds();
     m_nextButtonSprite.setOrigin(b.width/2.f, b.height/2.f);
     m_nextButtonSprite.setScale(Constants::MENU_BUTTON_SCALE, Constants::MENU_BUTTON_SCALE);
-    m_nextButtonSprite.setPosition(window.getSize().x/2.f,
-                                   window.getSize().y - Constants::STAGE_SUMMARY_NEXT_BUTTON_OFFSET);
+    m_nextButtonSprite.setPosition(windowSize.x/2.f,
+                                   windowSize.y - Constants::STAGE_SUMMARY_NEXT_BUTTON_OFFSET);
 
     m_nextText.setFont(font);
     m_nextText.setString("NEXT");
@@ -98,17 +64,15 @@ void StageSummaryState::setupItems() {
 
     float startY = Constants::STAGE_SUMMARY_ITEM_START_Y;
     float spacing = Constants::STAGE_SUMMARY_ITEM_SPACING;
-    float spriteX = getGame().getWindow().getSize().x/2.f - Constants::STAGE_SUMMARY_SPRITE_X_OFFSET;
-    float textX = getGame().getWindow().getSize().x/2.f + Constants::STAGE_SUMMARY_TEXT_X_OFFSET;
+    float spriteX = getGame().getWindowSize().x/2.f - Constants::STAGE_SUMMARY_SPRITE_X_OFFSET;
+    float textX = getGame().getWindowSize().x/2.f + Constants::STAGE_SUMMARY_TEXT_X_OFFSET;
 
     int index = 0;
     std::for_each(cfg.counts.begin(), cfg.counts.end(),
         [&](const auto& kv) {
             Item item;
             item.sprite.setTexture(manager.getTexture(kv.first));
-            sf::IntRect rect = firstFrameRect(kv.first);
-            if (rect.width > 0)
-                item.sprite.setTextureRect(rect);
+            item.sprite.setTextureRect(manager.getFirstFrameRect(kv.first));
             auto b = item.sprite.getLocalBounds();
             item.sprite.setOrigin(b.width/2.f, b.height/2.f);
             item.sprite.setPosition(spriteX, startY + spacing*index);
@@ -165,16 +129,15 @@ void StageSummaryState::exitState() {
     });
 }
 
-void StageSummaryState::render() {
-    auto& window = getGame().getWindow();
-    window.draw(m_overlaySprite);
-    window.draw(m_scoreText);
-    std::for_each(m_items.begin(), m_items.end(), [&window](const Item& item) {
-        window.draw(item.sprite);
-        window.draw(item.text);
+void StageSummaryState::render(DrawList& target) {
+    target.draw(m_overlaySprite);
+    target.draw(m_scoreText);
+    std::for_each(m_items.begin(), m_items.end(), [&target](const Item& item) {
+        target.draw(item.sprite);
+        target.draw(item.text);
     });
-    window.draw(m_nextButtonSprite);
-    window.draw(m_nextText);
+    target.draw(m_nextButtonSprite);
+    target.draw(m_nextText);
 }
 
 } // namespace FishGame
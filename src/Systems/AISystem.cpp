@@ -0,0 +1,182 @@
+#include "AISystem.h"
+#include "Fish.h"
+#include "Player.h"
+#include <algorithm>
+#include <cmath>
+#include <execution>
+#include <limits>
+
+namespace FishGame
+{
+    AIEntityState AISystem::capture(const Entity& entity)
+    {
+        AIEntityState state;
+        state.entity = &entity;
+        state.position = entity.getPosition();
+        state.radius = entity.getRadius();
+        state.type = entity.getType();
+        state.size = entity.getSizeClass();
+        state.isFish = isFishKind(entity.getKind());
+        state.isPufferfish = entity.getKind() == EntityKind::Pufferfish;
+        state.isInflated = entity.isInflated();
+        state.predation = Predation::profileOf(entity);
+        return state;
+    }
+
+    AIEntityState AISystem::capture(const Player& player)
+    {
+        AIEntityState state;
+        state.entity = &player;
+        state.position = player.getPosition();
+        state.radius = player.getRadius();
+        state.type = EntityType::Player;
+        state.size = player.getCurrentFishSize();
+        state.isInvulnerable = player.isInvulnerable();
+        state.predation = Predation::profileOf(player);
+        return state;
+    }
+
+    void AISystem::captureSnapshot(const std::vector<std::unique_ptr<Entity>>& entities,
+        const Player* player)
+    {
+        m_snapshot.clear();
+        m_agents.clear();
+
+        if (player && player->isAlive())
+        {
+            m_snapshot.player = capture(*player);
+            m_snapshot.hasPlayer = true;
+        }
+
+        m_snapshot.entities.reserve(entities.size());
+        std::for_each(entities.begin(), entities.end(),
+            [this](const std::unique_ptr<Entity>& entity)
+            {
+                if (!entity || !entity->isAlive())
+                    return;
+
+                m_snapshot.entities.push_back(capture(*entity));
+                if (m_snapshot.entities.back().isFish)
+                {
+                    m_agents.push_back({ static_cast<Fish*>(entity.get()),
+                                         m_snapshot.entities.size() - 1 });
+                }
+            });
+    }
+
+    std::uint8_t AISystem::tierFor(sf::Vector2f position) const
+    {
+        auto distanceSq = [position](sf::Vector2f focus)
+            {
+                const sf::Vector2f d = position - focus;
+                return d.x * d.x + d.y * d.y;
+            };
+
+        float nearest = std::numeric_limits<float>::max();
+        if (m_snapshot.hasPlayer)
+            nearest = distanceSq(m_snapshot.player.position);
+        if (m_hasCameraFocus)
+            nearest = std::min(nearest, distanceSq(m_cameraFocus));
+
+        std::uint8_t tier = 0;
+        for (float distance : Constants::AI_LOD_DISTANCES)
+        {
+            const float scaled = distance * m_lodScale;
+            if (nearest < scaled * scaled)
+                break;
+            ++tier;
+        }
+        return tier;
+    }
+
+    bool AISystem::isDue(EntityId id, std::uint8_t tier) const
+    {
+        // Tier n plans every 2^n plan intervals; the id picks the phase so
+        // each tick gets an equal share of every tier
+        const std::uint64_t period = m_ticksPerPlan << tier;
+        return (m_tick + id) % period == 0;
+    }
+
+    void AISystem::rebalance(bool overran, sf::Time used)
+    {
+        // Push fish into slower tiers while over budget, ease back when idle
+        if (overran)
+            m_lodScale = std::max(0.25f, m_lodScale * 0.9f);
+        else if (used.asMicroseconds() * 2 < m_budget.asMicroseconds())
+            m_lodScale = std::min(1.0f, m_lodScale * 1.02f);
+    }
+
+    void AISystem::update(const std::vector<std::unique_ptr<Entity>>& entities,
+        const Player* player, sf::Time deltaTime)
+    {
+        ++m_tick;
+        if (deltaTime > sf::Time::Zero)
+        {
+            m_ticksPerPlan = std::max<std::uint64_t>(1,
+                static_cast<std::uint64_t>(std::lround(Constants::AI_PLAN_INTERVAL / deltaTime.asSeconds())));
+        }
+        captureSnapshot(entities, player);
+
+        // Bank time for every fish and collect the ones due this tick
+        m_due.clear();
+        std::for_each(m_agents.begin(), m_agents.end(), [this, deltaTime](Agent& agent)
+            {
+                Schedule& schedule = m_schedules[agent.fish->getId()];
+                schedule.pending += deltaTime;
+                schedule.lastSeen = m_tick;
+
+                agent.schedule = &schedule;
+                agent.tier = tierFor(m_snapshot.entities[agent.slot].position);
+                if (schedule.overdue || isDue(agent.fish->getId(), agent.tier))
+                    m_due.push_back(agent);
+            });
+        std::erase_if(m_schedules, [this](const auto& item) { return item.second.lastSeen != m_tick; });
+
+        // Carried-over work first, then nearest tiers
+        std::stable_sort(m_due.begin(), m_due.end(), [](const Agent& lhs, const Agent& rhs)
+            {
+                if (lhs.schedule->overdue != rhs.schedule->overdue)
+                    return lhs.schedule->overdue;
+                return lhs.tier < rhs.tier;
+            });
+
+        // Decision phase: each fish only writes its own plan. Chunks run
+        // until the budget is spent; at least one chunk always runs.
+        sf::Clock clock;
+        std::size_t planned = 0;
+        while (planned < m_due.size())
+        {
+            const std::size_t end = std::min(planned + Constants::AI_PLAN_CHUNK, m_due.size());
+            std::for_each(std::execution::par,
+                m_due.begin() + static_cast<std::ptrdiff_t>(planned),
+                m_due.begin() + static_cast<std::ptrdiff_t>(end),
+                [this](const Agent& agent)
+                {
+                    agent.fish->planAI(m_snapshot, m_snapshot.entities[agent.slot],
+                        agent.schedule->pending);
+                });
+            planned = end;
+
+            if (clock.getElapsedTime() >= m_budget)
+                break;
+        }
+        const sf::Time used = clock.getElapsedTime();
+        m_deferredCount = m_due.size() - planned;
+
+        const auto plannedEnd = m_due.begin() + static_cast<std::ptrdiff_t>(planned);
+        std::for_each(plannedEnd, m_due.end(),
+            [](const Agent& agent) { agent.schedule->overdue = true; });
+
+        // Apply phase: deterministic entity order
+        std::sort(m_due.begin(), plannedEnd,
+            [](const Agent& lhs, const Agent& rhs) { return lhs.slot < rhs.slot; });
+        std::for_each(m_due.begin(), plannedEnd, [](const Agent& agent)
+            {
+                agent.fish->applyAI();
+                agent.schedule->pending = sf::Time::Zero;
+                agent.schedule->overdue = false;
+            });
+
+        rebalance(m_deferredCount > 0, used);
+    }
+}
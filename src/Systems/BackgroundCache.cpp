@@ -0,0 +1,64 @@
+#include "BackgroundCache.h"
+#include "GameConstants.h"
+
+namespace FishGame
+{
+    // Cleared to the window colour so the blit can skip blending
+    BackgroundCache::BackgroundCache()
+        : m_composite(Constants::OCEAN_BLUE, sf::BlendNone)
+    {
+    }
+
+    void BackgroundCache::setTexture(const sf::Texture& texture, sf::Vector2u size)
+    {
+        if (m_texture == &texture && m_size == size)
+            return;
+
+        m_texture = &texture;
+        m_size = size;
+        refresh();
+    }
+
+    void BackgroundCache::setTint(const sf::Color& tint)
+    {
+        if (m_tint == tint)
+            return;
+
+        m_tint = tint;
+        refresh();
+    }
+
+    void BackgroundCache::drawComposite(DrawList& target, sf::RenderStates states, sf::Vector2u size) const
+    {
+        sf::Sprite backdrop(*m_texture);
+        const sf::Vector2u textureSize = m_texture->getSize();
+        backdrop.setScale(
+            static_cast<float>(size.x) / static_cast<float>(textureSize.x),
+            static_cast<float>(size.y) / static_cast<float>(textureSize.y));
+        target.draw(backdrop, states);
+
+        if (m_tint.a > 0)
+        {
+            sf::RectangleShape tint{ sf::Vector2f(size) };
+            tint.setFillColor(m_tint);
+            target.draw(tint, states);
+        }
+    }
+
+    void BackgroundCache::refresh()
+    {
+        if (!m_texture)
+            return;
+
+        // Recorded at source resolution; only the final blit scales to the view
+        const sf::Vector2u textureSize = m_texture->getSize();
+        DrawList& content = m_composite.record(textureSize, m_texture->isSmooth());
+        drawComposite(content, sf::RenderStates::Default, textureSize);
+    }
+
+    void BackgroundCache::draw(DrawList& target, sf::RenderStates states) const
+    {
+        if (m_composite.hasContent())
+            target.draw(m_composite, sf::Vector2f(m_size), states);
+    }
+}
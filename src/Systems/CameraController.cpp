@@ -1,15 +1,24 @@
 #include "CameraController.h"
 #include <algorithm>
+#include <cmath>
 
 namespace FishGame
 {
     CameraController::CameraController(const sf::View& view, sf::Vector2f worldSize,
         float smoothing)
-        : m_view(view), m_worldSize(worldSize), m_smoothing(smoothing)
+        : m_view(view), m_previousCenter(view.getCenter()), m_worldSize(worldSize), m_smoothing(smoothing)
     {
     }
 
-    void CameraController::update(const sf::Vector2f& targetPos)
+    sf::View CameraController::getInterpolatedView(float alpha) const
+    {
+        sf::View view = m_view;
+        const sf::Vector2f current = m_view.getCenter();
+        view.setCenter(m_previousCenter + (current - m_previousCenter) * alpha);
+        return view;
+    }
+
+    void CameraController::update(const sf::Vector2f& targetPos, sf::Time deltaTime)
     {
         if (m_frozen)
         {
@@ -31,7 +40,8 @@ namespace FishGame
             target.y = m_worldSize.y * 0.5f;
 
         sf::Vector2f current = m_view.getCenter();
-        sf::Vector2f newCenter = current + (target - current) * m_smoothing;
+        const float follow = 1.f - std::exp(-m_smoothing * deltaTime.asSeconds());
+        sf::Vector2f newCenter = current + (target - current) * follow;
         m_view.setCenter(newCenter);
     }
 
@@ -0,0 +1,68 @@
+#include "CircleBatch.h"
+
+#if defined(__AVX2__) || defined(__AVX__)
+#include <immintrin.h>
+#define FISHGAME_CIRCLE_BATCH_AVX 1
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define FISHGAME_CIRCLE_BATCH_SSE 1
+#endif
+
+namespace FishGame::CircleBatch
+{
+    namespace
+    {
+        inline bool overlapsScalar(float x, float y, float radius,
+                                   float ox, float oy, float oradius) noexcept
+        {
+            const float dx = ox - x;
+            const float dy = oy - y;
+            const float radiusSum = oradius + radius;
+            return dx * dx + dy * dy < radiusSum * radiusSum;
+        }
+    }
+
+    std::uint32_t overlapMask(float x, float y, float radius,
+                              const float* xs, const float* ys, const float* radii,
+                              std::size_t count) noexcept
+    {
+        std::uint32_t mask = 0;
+        std::size_t i = 0;
+
+#if defined(FISHGAME_CIRCLE_BATCH_AVX)
+        const __m256 cx = _mm256_set1_ps(x);
+        const __m256 cy = _mm256_set1_ps(y);
+        const __m256 cr = _mm256_set1_ps(radius);
+        for (; i + 8 <= count; i += 8)
+        {
+            const __m256 dx = _mm256_sub_ps(_mm256_loadu_ps(xs + i), cx);
+            const __m256 dy = _mm256_sub_ps(_mm256_loadu_ps(ys + i), cy);
+            const __m256 sum = _mm256_add_ps(_mm256_loadu_ps(radii + i), cr);
+            const __m256 distSq = _mm256_add_ps(_mm256_mul_ps(dx, dx), _mm256_mul_ps(dy, dy));
+            const __m256 hit = _mm256_cmp_ps(distSq, _mm256_mul_ps(sum, sum), _CMP_LT_OQ);
+            mask |= static_cast<std::uint32_t>(_mm256_movemask_ps(hit)) << i;
+        }
+#elif defined(FISHGAME_CIRCLE_BATCH_SSE)
+        const __m128 cx = _mm_set1_ps(x);
+        const __m128 cy = _mm_set1_ps(y);
+        const __m128 cr = _mm_set1_ps(radius);
+        for (; i + 4 <= count; i += 4)
+        {
+            const __m128 dx = _mm_sub_ps(_mm_loadu_ps(xs + i), cx);
+            const __m128 dy = _mm_sub_ps(_mm_loadu_ps(ys + i), cy);
+            const __m128 sum = _mm_add_ps(_mm_loadu_ps(radii + i), cr);
+            const __m128 distSq = _mm_add_ps(_mm_mul_ps(dx, dx), _mm_mul_ps(dy, dy));
+            const __m128 hit = _mm_cmplt_ps(distSq, _mm_mul_ps(sum, sum));
+            mask |= static_cast<std::uint32_t>(_mm_movemask_ps(hit)) << i;
+        }
+#endif
+
+        // Scalar tail, and the whole batch on targets without SIMD
+        for (; i < count; ++i)
+        {
+            if (overlapsScalar(x, y, radius, xs[i], ys[i], radii[i]))
+                mask |= 1u << i;
+        }
+        return mask;
+    }
+}
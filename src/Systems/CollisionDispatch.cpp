@@ -0,0 +1,78 @@
+#include "CollisionDispatch.h"
+#include "CollisionSystem.h"
+#include "Fish.h"
+#include "PoisonFish.h"
+#include "Hazard.h"
+#include "OysterManager.h"
+#include "Player.h"
+
+namespace FishGame::CollisionResponses
+{
+    void playerTouches(Entity& player, Entity& other, CollisionSystem& system)
+    {
+        other.onCollide(static_cast<Player&>(player), system);
+    }
+
+    void playerOyster(Entity& player, Entity& oyster, CollisionSystem& system)
+    {
+        system.handleOysterCollision(static_cast<Player&>(player),
+                                     static_cast<PermanentOyster*>(&oyster));
+    }
+
+    void fishFish(Entity& a, Entity& b, CollisionSystem& system)
+    {
+        auto& fish = static_cast<Fish&>(a);
+        auto& other = static_cast<Fish&>(b);
+
+        if (fish.canEat(other))
+        {
+            if (other.getKind() == EntityKind::PoisonFish)
+            {
+                fish.setPoisoned(static_cast<PoisonFish&>(other).getPoisonDuration());
+                system.createParticle(fish.getPosition(), sf::Color::Magenta, 10);
+            }
+            fish.playEatAnimation();
+            other.destroy();
+            system.createParticle(other.getPosition(), Constants::DEATH_PARTICLE_COLOR);
+        }
+        else if (other.canEat(fish))
+        {
+            if (fish.getKind() == EntityKind::PoisonFish)
+            {
+                other.setPoisoned(static_cast<PoisonFish&>(fish).getPoisonDuration());
+                system.createParticle(other.getPosition(), sf::Color::Magenta, 10);
+            }
+            other.playEatAnimation();
+            fish.destroy();
+            system.createParticle(fish.getPosition(), Constants::DEATH_PARTICLE_COLOR);
+        }
+    }
+
+    void fishBomb(Entity& fish, Entity& bomb, CollisionSystem& system)
+    {
+        auto& b = static_cast<Bomb&>(bomb);
+        bool wasExploding = b.isExploding();
+        b.onContact(fish);
+        if (!wasExploding && b.isExploding())
+        {
+            system.m_sounds.play(SoundEffectID::MineExplode);
+        }
+    }
+
+    void fishJellyfish(Entity& fish, Entity& jellyfish, CollisionSystem& /*system*/)
+    {
+        auto& jelly = static_cast<Jellyfish&>(jellyfish);
+        jelly.onContact(fish);
+        static_cast<Fish&>(fish).setStunned(jelly.getStunDuration());
+    }
+
+    void fishOyster(Entity& fish, Entity& oyster, CollisionSystem& system)
+    {
+        if (static_cast<PermanentOyster&>(oyster).canDamagePlayer())
+        {
+            fish.destroy();
+            system.createParticle(fish.getPosition(), Constants::DEATH_PARTICLE_COLOR);
+            system.createParticle(oyster.getPosition(), Constants::OYSTER_IMPACT_COLOR);
+        }
+    }
+}
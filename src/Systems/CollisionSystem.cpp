@@ -4,7 +4,10 @@
 #include "Pufferfish.h"
 #include "Angelfish.h"
 #include "PoisonFish.h"
+#include "CollisionDispatch.h"
 #include <algorithm>
+#include <cmath>
+#include <tuple>
 
 namespace FishGame
 {
@@ -30,6 +33,14 @@ namespace FishGame
         , m_onPlayerDeath(std::move(onPlayerDeath))
         , m_applyFreeze(std::move(applyFreeze))
         , m_reverseControls(std::move(reverseControls))
+        , m_grid(sf::FloatRect(0.f, 0.f,
+                               static_cast<float>(Constants::WINDOW_WIDTH),
+                               static_cast<float>(Constants::WINDOW_HEIGHT)),
+                 Constants::COLLISION_CELL_SIZE)
+        , m_staticGrid(sf::FloatRect(0.f, 0.f,
+                                     static_cast<float>(Constants::WINDOW_WIDTH),
+                                     static_cast<float>(Constants::WINDOW_HEIGHT)),
+                       Constants::COLLISION_CELL_SIZE)
     {
     }
 
@@ -51,7 +62,7 @@ namespace FishGame
         if (oyster->canDamagePlayer() && !player.isInvulnerable())
         {
             player.takeDamage();
-            m_onPlayerDeath();
+            requestPlayerDeath();
             createParticle(player.getPosition(), Constants::DAMAGE_PARTICLE_COLOR);
         }
         else if (oyster->canBeEaten())
@@ -76,58 +87,320 @@ namespace FishGame
         }
     }
 
-    // --- Process -----------------------------------------------------------
-    void CollisionSystem::process(Player& player,
-                                  std::vector<std::unique_ptr<Entity>>& entities,
-                                  std::vector<std::unique_ptr<BonusItem>>& bonusItems,
-                                  std::vector<std::unique_ptr<Hazard>>& hazards,
-                                  FixedOysterManager* oysters,
-                                  int currentLevel)
+    // --- Detection ---------------------------------------------------------
+    void CollisionSystem::addContact(Entity& a, Entity& b, ContactType type,
+                                     std::size_t indexA, std::size_t indexB)
     {
-        EntityUtils::forEachAlive(entities, [this,&player](Entity& e){
-            if (EntityUtils::areColliding(player, e)) {
-                e.onCollide(player, *this);
-            }
-        });
+        // Only throttled pairs need to be remembered across ticks
+        if (CollisionDispatch::repeatSeconds(a.getKind(), b.getKind()) > 0.f)
+            m_contactCache.touch(a, b);
+        m_contacts.push_back({ &a, &b, type,
+                               EntityUtils::penetration(a, b),
+                               static_cast<std::uint32_t>(indexA),
+                               static_cast<std::uint32_t>(indexB),
+                               sweepOf(a).swept || sweepOf(b).swept });
+    }
+
+    CollisionSystem::Sweep CollisionSystem::sweepOf(const Entity& entity) noexcept
+    {
+        const sf::Vector2f delta = entity.getSweepDelta();
+        const float distanceSq = delta.x * delta.x + delta.y * delta.y;
+        const float threshold = entity.getRadius() * Constants::SWEEP_RADIUS_FRACTION;
+
+        if (distanceSq <= threshold * threshold ||
+            distanceSq > Constants::SWEEP_MAX_DISTANCE * Constants::SWEEP_MAX_DISTANCE)
+        {
+            return { entity.getPosition(), sf::Vector2f(0.f, 0.f), false };
+        }
+        return { entity.getSweepStart(), delta, true };
+    }
+
+    float CollisionSystem::sweepReach(const Entity& entity, const Sweep& sweep) noexcept
+    {
+        return entity.getRadius() +
+            0.5f * std::sqrt(sweep.delta.x * sweep.delta.x + sweep.delta.y * sweep.delta.y);
+    }
+
+    bool CollisionSystem::touching(const Entity& a, const Entity& b) noexcept
+    {
+        const Sweep sweepA = sweepOf(a);
+        const Sweep sweepB = sweepOf(b);
+        if (!sweepA.swept && !sweepB.swept)
+            return EntityUtils::areColliding(a, b);
+
+        return EntityUtils::timeOfImpact(sweepA.start, sweepA.delta, sweepB.start, sweepB.delta,
+                                         a.getRadius() + b.getRadius()) >= 0.0f;
+    }
+
+    void CollisionSystem::addToGrid(Entity& entity, std::uint32_t group, std::size_t index)
+    {
+        // Fast movers occupy the circle enclosing their whole path this tick
+        const Sweep sweep = sweepOf(entity);
+        if (sweep.swept)
+            m_grid.add(entity, sweep.center(), sweepReach(entity, sweep), group, static_cast<std::uint32_t>(index));
+        else
+            m_grid.add(entity, group, static_cast<std::uint32_t>(index));
+    }
 
-        EntityUtils::forEachAlive(bonusItems, [this,&player](auto& e){
-            if (EntityUtils::areColliding(player, e)) {
-                e.onCollide(player, *this);
+    void CollisionSystem::endSweeps(Player& player,
+                                    std::vector<std::unique_ptr<Entity>>& entities,
+                                    std::vector<std::unique_ptr<BonusItem>>& bonusItems,
+                                    std::vector<std::unique_ptr<Hazard>>& hazards,
+                                    FixedOysterManager* oysters)
+    {
+        player.resetSweep();
+        StateUtils::applyToEntities(entities, [](Entity& e) { e.resetSweep(); });
+        StateUtils::applyToEntities(bonusItems, [](Entity& e) { e.resetSweep(); });
+        StateUtils::applyToEntities(hazards, [](Entity& e) { e.resetSweep(); });
+        if (oysters)
+        {
+            for (std::size_t i = 0; i < FixedOysterManager::getCount(); ++i)
+                oysters->getOyster(i).resetSweep();
+        }
+    }
+
+    void CollisionSystem::refreshStaticGrid(std::vector<std::unique_ptr<BonusItem>>& bonusItems,
+                                            FixedOysterManager* oysters)
+    {
+        m_pendingKeys.clear();
+        for (const auto& item : bonusItems)
+        {
+            if (item)
+                m_pendingKeys.push_back({ item.get(), item->getRestPosition() });
+        }
+        if (oysters)
+        {
+            for (std::size_t i = 0; i < FixedOysterManager::getCount(); ++i)
+            {
+                const PermanentOyster& oyster = oysters->getOyster(i);
+                m_pendingKeys.push_back({ &oyster, oyster.getRestPosition() });
             }
-        });
+        }
+
+        if (m_pendingKeys == m_staticKeys)
+            return;
+
+        m_staticKeys.swap(m_pendingKeys);
+        m_staticGrid.clear();
 
-        EntityUtils::forEachAlive(hazards, [this,&player](auto& h){
-            if (EntityUtils::areColliding(player, h)) {
-                h.onCollide(player, *this);
+        // Insert each item with the full reach of its bob so the cells stay
+        // valid for as long as it exists
+        for (std::size_t i = 0; i < bonusItems.size(); ++i)
+        {
+            if (BonusItem* item = bonusItems[i].get())
+            {
+                m_staticGrid.add(*item, item->getRestPosition(),
+                                 item->getRadius() + item->getBobReach(),
+                                 BonusGroup, static_cast<std::uint32_t>(i));
+            }
+        }
+        if (oysters)
+        {
+            for (std::size_t i = 0; i < FixedOysterManager::getCount(); ++i)
+            {
+                PermanentOyster& oyster = oysters->getOyster(i);
+                m_staticGrid.add(oyster, oyster.getRestPosition(),
+                                 oyster.getRadius() + oyster.getBobReach(),
+                                 OysterGroup, static_cast<std::uint32_t>(i));
             }
-        });
+        }
+        m_staticGrid.build();
+    }
+
+    void CollisionSystem::detectStatic(Entity& entity, std::size_t index, LayerMask layers,
+                                       ContactType bonusContact, ContactType oysterContact)
+    {
+        // The grid only holds conservative bounds, so confirm on live data
+        const Sweep sweep = sweepOf(entity);
+        m_staticGrid.query(sweep.center(), sweepReach(entity, sweep), layers,
+            [&](const SpatialGrid::Proxy& proxy)
+            {
+                Entity& other = *proxy.entity;
+                if (!other.isAlive() || !m_filter.shouldCollide(entity, other) ||
+                    !touching(entity, other))
+                    return;
 
-        if (currentLevel >= 2 && oysters)
+                addContact(entity, other,
+                           proxy.group == OysterGroup ? oysterContact : bonusContact,
+                           index, proxy.index);
+            });
+    }
+
+    void CollisionSystem::detectContacts(Player& player,
+                                         std::vector<std::unique_ptr<Entity>>& entities,
+                                         std::vector<std::unique_ptr<BonusItem>>& bonusItems,
+                                         std::vector<std::unique_ptr<Hazard>>& hazards,
+                                         FixedOysterManager* oysters, int currentLevel)
+    {
+        const bool oystersActive = currentLevel >= 2 && oysters;
+
+        // Fish and hazards move every tick, so the grid is rebuilt each time
+        m_grid.clear();
+        for (std::size_t i = 0; i < entities.size(); ++i)
         {
-            oysters->checkCollisions(player, [this,&player](PermanentOyster* o){ handleOysterCollision(player,o); });
+            if (entities[i] && entities[i]->isAlive())
+                addToGrid(*entities[i], EntityGroup, i);
         }
+        for (std::size_t i = 0; i < hazards.size(); ++i)
+        {
+            if (hazards[i] && hazards[i]->isAlive())
+                addToGrid(*hazards[i], HazardGroup, i);
+        }
+        m_grid.build();
 
-        StateUtils::processCollisionsBetween(entities, entities,
-            [this](Entity& a, Entity& b){ a.onCollideWith(b, *this); });
+        const LayerMask playerLayers = static_cast<LayerMask>(
+            m_filter.maskFor(player.getCollisionCategory()) & player.getCollisionMask());
+        const Sweep playerSweep = sweepOf(player);
+        m_grid.query(playerSweep.center(), sweepReach(player, playerSweep), playerLayers,
+            [this, &player, &playerSweep](const SpatialGrid::Proxy& proxy)
+            {
+                if ((proxy.mask & player.getCollisionCategory()) == 0)
+                    return;
+                if ((playerSweep.swept || proxy.conservative) && !touching(player, *proxy.entity))
+                    return;
+                addContact(player, *proxy.entity,
+                           proxy.group == HazardGroup ? ContactType::PlayerHazard
+                                                      : ContactType::PlayerEntity,
+                           0, proxy.index);
+            });
+
+        refreshStaticGrid(bonusItems, oystersActive ? oysters : nullptr);
 
-        StateUtils::processCollisionsBetween(entities, hazards,
-            [this](Entity& e, Hazard& h){ e.onCollideWith(h, *this); });
-        processBombExplosions(entities, hazards);
+        if (!m_staticGrid.empty())
+        {
+            detectStatic(player, 0, playerLayers,
+                         ContactType::PlayerBonus, ContactType::PlayerOyster);
+        }
 
-        StateUtils::applyToEntities(entities, [this,&player](Entity& e){
-            if (player.attemptTailBite(e))
+        // Each unordered pair once; Fish handlers resolve both directions
+        m_grid.forEachPair(m_filter,
+            [this](const SpatialGrid::Proxy& a, const SpatialGrid::Proxy& b)
             {
-                createParticle(player.getPosition(), Constants::TAILBITE_PARTICLE_COLOR);
+                if ((a.conservative || b.conservative) && !touching(*a.entity, *b.entity))
+                    return;
+
+                if (a.group == EntityGroup && b.group == EntityGroup)
+                {
+                    const bool ordered = a.index < b.index;
+                    const auto& first = ordered ? a : b;
+                    const auto& second = ordered ? b : a;
+                    addContact(*first.entity, *second.entity, ContactType::EntityEntity,
+                               first.index, second.index);
+                }
+                else if (a.group != b.group)
+                {
+                    const auto& entity = a.group == EntityGroup ? a : b;
+                    const auto& hazard = a.group == EntityGroup ? b : a;
+                    addContact(*entity.entity, *hazard.entity, ContactType::EntityHazard,
+                               entity.index, hazard.index);
+                }
+            });
+
+        // Only moving entities query the static structure
+        if (m_staticGrid.empty())
+            return;
+
+        for (std::size_t i = 0; i < entities.size(); ++i)
+        {
+            Entity* a = entities[i].get();
+            if (!a || !a->isAlive())
+                continue;
+
+            // Fish have no contact type for bonus items, only oysters
+            const LayerMask layers = static_cast<LayerMask>(
+                m_filter.maskFor(a->getCollisionCategory()) & a->getCollisionMask() &
+                CollisionLayer::Oyster);
+            if (layers != CollisionLayer::None)
+            {
+                detectStatic(*a, i, layers,
+                             ContactType::EntityOyster, ContactType::EntityOyster);
             }
-        });
+        }
+    }
+
+    // --- Resolution --------------------------------------------------------
+    void CollisionSystem::resolveContact(Player& player, const Contact& contact)
+    {
+        // Earlier contacts this tick may have eaten or destroyed either side
+        const bool playerContact = contact.a == &player;
+        if (!contact.b->isAlive() || (!playerContact && !contact.a->isAlive()))
+            return;
 
-        if (currentLevel >= 2 && oysters)
+        // Once the player has died this tick nothing else may touch them
+        if (playerContact && m_playerDeathPending)
+            return;
+
+        // Lasting contacts with a repeat interval only respond on begin and
+        // then once per interval
+        const float repeat = CollisionDispatch::repeatSeconds(contact.a->getKind(), contact.b->getKind());
+        if (repeat > 0.f)
         {
-            StateUtils::applyToEntities(entities, [this,oysters](Entity& e){
-                oysters->checkCollisions(e, [this,&e](PermanentOyster* o){
-                    e.onCollideWith(*o, *this);
-                });
+            // Hazards ignore an invulnerable player; skip before the gate so
+            // the interval is not spent and the response lands as soon as
+            // invulnerability ends
+            if (playerContact && player.isInvulnerable())
+                return;
+            if (!m_contactCache.shouldFire(*contact.a, *contact.b, sf::seconds(repeat)))
+                return;
+        }
+
+        m_contactSwept = contact.swept;
+        CollisionDispatch::dispatch(*contact.a, *contact.b, *this);
+        m_contactSwept = false;
+    }
+
+    void CollisionSystem::resolveContacts(Player& player)
+    {
+        // Deterministic order regardless of how detection was scheduled
+        std::sort(m_contacts.begin(), m_contacts.end(),
+            [](const Contact& lhs, const Contact& rhs)
+            {
+                return std::tie(lhs.type, lhs.indexA, lhs.indexB)
+                     < std::tie(rhs.type, rhs.indexA, rhs.indexB);
+            });
+
+        std::for_each(m_contacts.begin(), m_contacts.end(),
+            [this, &player](const Contact& contact) { resolveContact(player, contact); });
+    }
+
+    // --- Process -----------------------------------------------------------
+    void CollisionSystem::process(Player& player,
+                                  std::vector<std::unique_ptr<Entity>>& entities,
+                                  std::vector<std::unique_ptr<BonusItem>>& bonusItems,
+                                  std::vector<std::unique_ptr<Hazard>>& hazards,
+                                  FixedOysterManager* oysters,
+                                  int currentLevel,
+                                  sf::Time deltaTime)
+    {
+        m_contacts.clear();
+        m_playerDeathPending = false;
+        m_contactCache.beginTick(deltaTime);
+
+        detectContacts(player, entities, bonusItems, hazards, oysters, currentLevel);
+        resolveContacts(player);
+        m_contactCache.endTick();
+
+        // The broad-phase grid from detection already holds fish and hazards
+        processBombExplosions(m_grid, hazards);
+
+        if (!m_playerDeathPending)
+        {
+            StateUtils::applyToEntities(entities, [this,&player](Entity& e){
+                if (player.attemptTailBite(e))
+                {
+                    createParticle(player.getPosition(), Constants::TAILBITE_PARTICLE_COLOR);
+                }
             });
         }
+
+        // Next tick's sweeps start from where everything ended up now
+        endSweeps(player, entities, bonusItems, hazards, oysters);
+
+        // Player deaths are batched into a single callback per tick
+        if (m_playerDeathPending)
+        {
+            m_playerDeathPending = false;
+            m_onPlayerDeath();
+        }
     }
 }
@@ -0,0 +1,45 @@
+#include "ContactCache.h"
+
+namespace FishGame
+{
+    void ContactCache::beginTick(sf::Time deltaTime)
+    {
+        ++m_tick;
+        m_clock += deltaTime;
+    }
+
+    void ContactCache::touch(const Entity& a, const Entity& b)
+    {
+        auto it = m_pairs.try_emplace(key(a.getId(), b.getId()),
+            Entry{ m_tick, sf::Time::Zero, false }).first;
+        it->second.lastSeenTick = m_tick;
+    }
+
+    bool ContactCache::shouldFire(const Entity& a, const Entity& b, sf::Time repeatInterval)
+    {
+        auto it = m_pairs.find(key(a.getId(), b.getId()));
+        if (it == m_pairs.end())
+            return true;
+
+        Entry& entry = it->second;
+        if (entry.hasFired && m_clock - entry.lastFired < repeatInterval)
+            return false;
+
+        entry.hasFired = true;
+        entry.lastFired = m_clock;
+        return true;
+    }
+
+    void ContactCache::endTick()
+    {
+        std::erase_if(m_pairs, [this](const auto& item)
+            {
+                return item.second.lastSeenTick != m_tick;
+            });
+    }
+
+    void ContactCache::clear()
+    {
+        m_pairs.clear();
+    }
+}
@@ -9,6 +9,26 @@
 
 namespace FishGame
 {
+    namespace
+    {
+        constexpr sf::Color backgroundFishColor(255, 255, 255, 100);
+        constexpr sf::Color currentParticleColor(200, 200, 255, 100);
+
+        // Mixes the tint into the colour by the tint's alpha, keeping the
+        // colour's own alpha. Drawn over a backdrop that was tinted the same
+        // way, this gives exactly what drawing the untinted colour and then a
+        // full-screen tint overlay would.
+        sf::Color tinted(const sf::Color& color, const sf::Color& tint)
+        {
+            auto mix = [&tint](sf::Uint8 channel, sf::Uint8 tintChannel)
+                {
+                    return static_cast<sf::Uint8>(
+                        (channel * (255 - tint.a) + tintChannel * tint.a + 127) / 255);
+                };
+            return sf::Color(mix(color.r, tint.r), mix(color.g, tint.g), mix(color.b, tint.b), color.a);
+        }
+    }
+
     // BackgroundLayer implementation
     BackgroundLayer::BackgroundLayer(float scrollSpeed, const sf::Color& color)
         : m_elements()
@@ -30,11 +50,12 @@ namespace FishGame
             m_scrollOffset -= 100.0f;
         }
 
-        // Update element positions
+        // Update element positions; drift is 6x the scroll speed per second
+        const float drift = m_scrollSpeed * 6.0f * deltaTime.asSeconds();
         std::for_each(m_elements.begin(), m_elements.end(),
-            [this](sf::RectangleShape& element) {
+            [drift](sf::RectangleShape& element) {
                 sf::Vector2f pos = element.getPosition();
-                pos.x += m_scrollSpeed * 0.1f;
+                pos.x += drift;
 
                 if (pos.x > 2000.0f)
                 {
@@ -45,7 +66,7 @@ namespace FishGame
             });
     }
 
-    void BackgroundLayer::draw(sf::RenderTarget& target) const
+    void BackgroundLayer::draw(DrawList& target) const
     {
         std::for_each(m_elements.begin(), m_elements.end(),
             [&target](const sf::RectangleShape& element) {
@@ -59,6 +80,20 @@ namespace FishGame
         generateElements();
     }
 
+    void BackgroundLayer::setTint(const sf::Color& tint)
+    {
+        if (tint == m_tint)
+            return;
+        m_tint = tint;
+        applyTint();
+    }
+
+    void BackgroundLayer::applyTint()
+    {
+        for (std::size_t i = 0; i < m_elements.size(); ++i)
+            m_elements[i].setFillColor(tinted(m_elementColors[i], m_tint));
+    }
+
     void BackgroundLayer::generateElements()
     {
         m_elements.clear();
@@ -115,6 +150,11 @@ namespace FishGame
                 });
             break;
         }
+
+        m_elementColors.clear();
+        std::transform(m_elements.begin(), m_elements.end(), std::back_inserter(m_elementColors),
+            [](const sf::RectangleShape& element) { return element.getFillColor(); });
+        applyTint();
     }
 
     // OceanCurrentSystem implementation
@@ -136,7 +176,7 @@ namespace FishGame
             CurrentParticle particle;
             particle.shape = sf::CircleShape(2.0f);
             particle.shape.setPosition(xDist(rng), yDist(rng));
-            particle.shape.setFillColor(sf::Color(200, 200, 255, 100));
+            particle.shape.setFillColor(currentParticleColor);
             particle.velocity = m_currentDirection * m_currentStrength;
             particle.lifetime = 5.0f;
             particle.alpha = 100.0f;
@@ -172,7 +212,7 @@ namespace FishGame
         return force;
     }
 
-    void OceanCurrentSystem::drawDebug(sf::RenderTarget& target) const
+    void OceanCurrentSystem::drawDebug(DrawList& target) const
     {
         std::for_each(m_particles.begin(), m_particles.end(),
             [&target](const CurrentParticle& particle) {
@@ -180,6 +220,13 @@ namespace FishGame
             });
     }
 
+    void OceanCurrentSystem::setTint(const sf::Color& tint)
+    {
+        const sf::Color color = tinted(currentParticleColor, tint);
+        std::for_each(m_particles.begin(), m_particles.end(),
+            [&color](CurrentParticle& particle) { particle.shape.setFillColor(color); });
+    }
+
     void OceanCurrentSystem::updateParticles(sf::Time deltaTime)
     {
         std::for_each(m_particles.begin(), m_particles.end(),
@@ -237,7 +284,7 @@ namespace FishGame
             float radius = radiusDist(m_randomEngine);
             fish.shape.setRadius(radius);
             fish.shape.setOrigin(radius, radius);
-            fish.shape.setFillColor(sf::Color(255, 255, 255, 100));
+            fish.shape.setFillColor(backgroundFishColor);
             fish.shape.setPosition(xDist(m_randomEngine), yDist(m_randomEngine));
 
             float dir = dirDist(m_randomEngine) ? 1.f : -1.f;
@@ -301,6 +348,28 @@ namespace FishGame
         // Update lighting overlay
         sf::Color overlayColor = getAmbientLightColor();
         m_lightingOverlay.setFillColor(overlayColor);
+        applyLighting();
+    }
+
+    void EnvironmentSystem::setLightingOverlayEnabled(bool enabled)
+    {
+        m_lightingOverlayEnabled = enabled;
+        applyLighting();
+    }
+
+    void EnvironmentSystem::applyLighting()
+    {
+        // With the overlay on, it does the tinting over untinted shapes
+        const sf::Color tint = m_lightingOverlayEnabled ? sf::Color::Transparent : getAmbientLightColor();
+
+        m_farLayer->setTint(tint);
+        m_midLayer->setTint(tint);
+        m_nearLayer->setTint(tint);
+        m_oceanCurrents->setTint(tint);
+
+        const sf::Color fishColor = tinted(backgroundFishColor, tint);
+        for (auto& fish : m_backgroundFish)
+            fish.shape.setFillColor(fishColor);
     }
 
     void EnvironmentSystem::setRandomTimeOfDay()
@@ -340,7 +409,7 @@ namespace FishGame
         return m_oceanCurrents->getCurrentForce(position);
     }
 
-    void EnvironmentSystem::draw(sf::RenderTarget& target, sf::RenderStates states) const
+    void EnvironmentSystem::draw(DrawList& target, sf::RenderStates states) const
     {
         // Draw background layers (far to near)
         m_farLayer->draw(target);
@@ -358,7 +427,8 @@ namespace FishGame
         m_oceanCurrents->drawDebug(target);
 
         // Draw lighting overlay
-        target.draw(m_lightingOverlay, states);
+        if (m_lightingOverlayEnabled && m_lightingOverlay.getFillColor().a > 0)
+            target.draw(m_lightingOverlay, states);
     }
 
     void EnvironmentSystem::updateDayNightCycle(sf::Time deltaTime)
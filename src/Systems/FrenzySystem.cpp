@@ -1,9 +1,8 @@
 #include "FrenzySystem.h"
 #include "GameConstants.h"
 #include "SoundPlayer.h"
+#include "Utils/FixedString.h"
 #include <algorithm>
-#include <sstream>
-#include <iomanip>
 #include <cmath>
 
 namespace FishGame
@@ -121,7 +120,7 @@ namespace FishGame
         m_timerBar.setPosition(m_position.x, m_position.y + 90.0f);
     }
 
-    void FrenzySystem::draw(sf::RenderTarget& target, sf::RenderStates states) const
+    void FrenzySystem::draw(DrawList& target, sf::RenderStates states) const
     {
         if (m_currentLevel != FrenzyLevel::None)
         {
@@ -179,6 +178,7 @@ namespace FishGame
         {
             m_currentLevel = level;
             m_animationTimer = sf::Time::Zero;
+            m_shownTimerTenths = -1;
 
             // Update visuals based on level
             switch (level)
@@ -228,11 +228,15 @@ namespace FishGame
             float timerPercentage = m_frenzyTimer.asSeconds() / m_frenzyMaintainTime;
             m_timerBar.setSize(sf::Vector2f(m_timerBarWidth * timerPercentage, m_timerBarHeight));
 
-            // Update timer text
-            std::ostringstream timerStream;
-            timerStream << "Time: " << std::fixed << std::setprecision(1)
-                << m_frenzyTimer.asSeconds() << "s";
-            m_timerText.setString(timerStream.str());
+            // Update timer text when the shown tenth changes
+            const int timerTenths = std::max(0, (m_frenzyTimer.asMilliseconds() + 50) / 100);
+            if (timerTenths != m_shownTimerTenths)
+            {
+                m_shownTimerTenths = timerTenths;
+                FixedString<32> timerText;
+                (timerText << "Time: ").appendTenths(timerTenths) << 's';
+                m_timerText.setString(timerText.c_str());
+            }
 
             // Flash color
             float flash = std::abs(std::sin(m_animationTimer.asSeconds() * 10.0f));
@@ -1,11 +1,44 @@
 #include "HUDSystem.h"
-#include <sstream>
-#include <iomanip>
+#include "Utils/FixedString.h"
+#include <algorithm>
 
 namespace FishGame
 {
+    namespace
+    {
+        const char* powerUpName(PowerUpType type)
+        {
+            switch (type)
+            {
+            case PowerUpType::ScoreDoubler: return "2X Score";
+            case PowerUpType::SpeedBoost:   return "Speed Boost";
+            case PowerUpType::Freeze:       return "Freeze";
+            default:                        return nullptr;
+            }
+        }
+
+        // Effect timers are shown to a tenth of a second; -1 when inactive
+        int toTenths(bool active, sf::Time time)
+        {
+            return active ? std::max(0, (time.asMilliseconds() + 50) / 100) : -1;
+        }
+
+        template<typename T>
+        bool changed(T& shown, T value)
+        {
+            if (shown == value)
+                return false;
+            shown = value;
+            return true;
+        }
+
+        // Layer is stored with premultiplied alpha after drawing onto a clear target
+        const sf::BlendMode premultipliedAlpha(sf::BlendMode::One, sf::BlendMode::OneMinusSrcAlpha);
+    }
+
     HUDSystem::HUDSystem(const sf::Font& font, const sf::Vector2u& windowSize)
-        : m_font(font), m_windowSize(windowSize)
+        : m_layer(sf::Color::Transparent, premultipliedAlpha)
+        , m_font(font), m_windowSize(windowSize)
     {
         initText(m_scoreText, Constants::HUD_FONT_SIZE,
             sf::Vector2f(Constants::HUD_MARGIN, Constants::HUD_MARGIN));
@@ -28,68 +61,79 @@ namespace FishGame
         m_messageText.setOutlineThickness(Constants::MESSAGE_OUTLINE_THICKNESS);
     }
 
-    void HUDSystem::update(int score, int lives, int level, int chainBonus,
-        const std::vector<PowerUpType>& activePowerUps,
-        bool frozen, sf::Time freezeTime,
-        bool reversed, sf::Time reverseTime,
-        bool stunned, sf::Time stunTime,
-        float /*fps*/)
+    void HUDSystem::update(const HUDState& state)
     {
-        std::ostringstream stream;
-        stream << "Score: " << score;
-        m_scoreText.setString(stream.str());
+        FixedString<128> text;
+        bool dirty = false;
 
-        stream.str(""); stream.clear();
-        stream << "Lives: " << lives;
-        m_livesText.setString(stream.str());
+        if (changed(m_shown.score, state.score))
+        {
+            text << "Score: " << state.score;
+            m_scoreText.setString(text.c_str());
+            dirty = true;
+        }
 
-        stream.str(""); stream.clear();
-        stream << "Level: " << level;
-        m_levelText.setString(stream.str());
+        if (changed(m_shown.lives, state.lives))
+        {
+            text.clear();
+            text << "Lives: " << state.lives;
+            m_livesText.setString(text.c_str());
+            dirty = true;
+        }
 
-        if (chainBonus > 0)
+        if (changed(m_shown.level, state.level))
         {
-            stream.str(""); stream.clear();
-            stream << "Chain Bonus: +" << chainBonus;
-            m_chainText.setString(stream.str());
+            text.clear();
+            text << "Level: " << state.level;
+            m_levelText.setString(text.c_str());
+            dirty = true;
         }
-        else
+
+        if (changed(m_shown.chainBonus, state.chainBonus))
         {
-            m_chainText.setString("");
+            text.clear();
+            if (state.chainBonus > 0)
+                text << "Chain Bonus: +" << state.chainBonus;
+            m_chainText.setString(text.c_str());
+            dirty = true;
         }
 
-        if (!activePowerUps.empty())
+        if (changed(m_shown.powerUps, state.activePowerUps))
         {
-            stream.str(""); stream.clear();
-            stream << "\nActive Power-Ups:\n";
-            for (PowerUpType type : activePowerUps)
+            text.clear();
+            if (state.activePowerUps != 0)
             {
-                static std::unordered_map<PowerUpType,std::string> names = {
-                    {PowerUpType::ScoreDoubler, "2X Score"},
-                    {PowerUpType::SpeedBoost, "Speed Boost"},
-                    {PowerUpType::Freeze, "Freeze"}
-                };
-                if (auto it = names.find(type); it != names.end())
-                    stream << it->second << "\n";
+                text << "\nActive Power-Ups:\n";
+                for (auto type : { PowerUpType::ScoreDoubler, PowerUpType::SpeedBoost, PowerUpType::Freeze })
+                {
+                    if (state.activePowerUps & (1u << static_cast<unsigned>(type)))
+                        text << powerUpName(type) << '\n';
+                }
             }
-            m_powerUpText.setString(stream.str());
+            m_powerUpText.setString(text.c_str());
+            dirty = true;
         }
-        else
+
+        const int freezeTenths = toTenths(state.frozen, state.freezeTime);
+        const int reverseTenths = toTenths(state.reversed, state.reverseTime);
+        const int stunTenths = toTenths(state.stunned, state.stunTime);
+        if (changed(m_shown.freezeTenths, freezeTenths) |
+            changed(m_shown.reverseTenths, reverseTenths) |
+            changed(m_shown.stunTenths, stunTenths))
         {
-            m_powerUpText.setString("");
+            text.clear();
+            if (freezeTenths >= 0)
+                (text << "FREEZE ACTIVE: ").appendTenths(freezeTenths) << "s\n";
+            if (reverseTenths >= 0)
+                (text << "CONTROLS REVERSED: ").appendTenths(reverseTenths) << "s\n";
+            if (stunTenths >= 0)
+                (text << "STUNNED: ").appendTenths(stunTenths) << "s\n";
+            m_effectsText.setString(text.c_str());
+            dirty = true;
         }
 
-        stream.str(""); stream.clear();
-        if (frozen)
-            stream << "FREEZE ACTIVE: " << std::fixed << std::setprecision(1)
-                << freezeTime.asSeconds() << "s\n";
-        if (reversed)
-            stream << "CONTROLS REVERSED: " << std::fixed << std::setprecision(1)
-                << reverseTime.asSeconds() << "s\n";
-        if (stunned)
-            stream << "STUNNED: " << std::fixed << std::setprecision(1)
-                << stunTime.asSeconds() << "s\n";
-        m_effectsText.setString(stream.str());
+        if (dirty || !m_layer.hasContent())
+            drawWidgets(m_layer.record(m_windowSize), sf::RenderStates::Default);
     }
 
     void HUDSystem::showMessage(const std::string& message)
@@ -113,7 +157,7 @@ namespace FishGame
         text.setPosition(pos);
     }
 
-    void HUDSystem::draw(sf::RenderTarget& target, sf::RenderStates states) const
+    void HUDSystem::drawWidgets(DrawList& target, sf::RenderStates states) const
     {
         target.draw(m_scoreText, states);
         target.draw(m_livesText, states);
@@ -121,6 +165,19 @@ namespace FishGame
         target.draw(m_chainText, states);
         target.draw(m_powerUpText, states);
         target.draw(m_effectsText, states);
+    }
+
+    void HUDSystem::draw(DrawList& target, sf::RenderStates states) const
+    {
+        if (m_layer.hasContent())
+        {
+            target.draw(m_layer, sf::Vector2f(m_windowSize), states);
+        }
+        else
+        {
+            drawWidgets(target, states);
+        }
+
         if (!m_messageText.getString().isEmpty())
             target.draw(m_messageText, states);
     }
@@ -1,4 +1,5 @@
 #include "ParticleSystem.h"
+#include "DrawHelpers.h"
 #include <algorithm>
 #include <execution>
 #include <cmath>
@@ -47,9 +48,13 @@ namespace FishGame
         }
     }
 
-    void ParticleSystem::draw(sf::RenderTarget& target, sf::RenderStates states) const
+    void ParticleSystem::draw(DrawList& target, sf::RenderStates states) const
     {
+        const sf::FloatRect area = DrawUtils::visibleArea(target.getView(), Constants::PARTICLE_RADIUS);
         for(const auto& p : m_particles)
-            target.draw(p.shape, states);
+        {
+            if (area.contains(p.shape.getPosition()))
+                target.draw(p.shape, states);
+        }
     }
 }
@@ -1,88 +1,77 @@
 #include "ScoreSystem.h"
 #include "GameConstants.h"
+#include "DrawHelpers.h"
 #include <algorithm>
-#include <sstream>
-#include <iomanip>
 #include <cmath>
 
 namespace FishGame
 {
+    namespace
+    {
+        struct LabelStyle
+        {
+            unsigned int characterSize;
+            sf::Color color;
+            float outlineThickness;
+        };
+
+        // Indexed by FloatingScore::getStyle(), growing with score magnitude
+        const std::array<LabelStyle, 3> labelStyles{ {
+            { Constants::HUD_FONT_SIZE, sf::Color::White, 1.0f },
+            { 28, sf::Color::Yellow, 1.5f },
+            { 32, sf::Color::Magenta, 2.0f }
+        } };
+
+        // Same padding sf::Text puts around each glyph quad
+        constexpr float glyphPadding = 1.0f;
+
+        // Typical label: up to 12 characters, two triangles each for outline and fill
+        constexpr std::size_t verticesPerLabel = 12 * 6 * 2;
+    }
+
     // Static member initialization
     const sf::Time FloatingScore::m_maxLifetime = sf::seconds(1.5f);
 
     // FloatingScore implementation
-    FloatingScore::FloatingScore(const sf::Font& font, int points, int multiplier, sf::Vector2f position)
-        : m_text()
-        , m_velocity(0.0f, m_floatSpeed)
-        , m_lifetime(sf::Time::Zero)
-        , m_alpha(255.0f)
+    void FloatingScore::spawn(int points, int multiplier, sf::Vector2f position)
     {
-        m_text.setFont(font);
-        m_text.setPosition(position);
-
         // Format score text with multiplier
-        std::ostringstream scoreStream;
-        scoreStream << "+" << points;
+        m_label.clear();
+        m_label << '+' << points;
         if (multiplier > 1)
         {
-            scoreStream << " x" << multiplier;
-        }
-        m_text.setString(scoreStream.str());
-
-        // Set appearance based on score magnitude
-        if (points >= 500)
-        {
-            m_text.setCharacterSize(32);
-            m_text.setFillColor(sf::Color::Magenta);
-            m_text.setOutlineThickness(2.0f);
-        }
-        else if (points >= 100)
-        {
-            m_text.setCharacterSize(28);
-            m_text.setFillColor(sf::Color::Yellow);
-            m_text.setOutlineThickness(1.5f);
-        }
-        else
-        {
-            m_text.setCharacterSize(Constants::HUD_FONT_SIZE);
-            m_text.setFillColor(sf::Color::White);
-            m_text.setOutlineThickness(1.0f);
+            m_label << " x" << multiplier;
         }
 
-        m_text.setOutlineColor(sf::Color::Black);
+        // Pick appearance based on score magnitude
+        m_style = points >= 500 ? 2 : (points >= 100 ? 1 : 0);
 
-        // Center text origin
-        sf::FloatRect bounds = m_text.getLocalBounds();
-        m_text.setOrigin(bounds.width / 2.0f, bounds.height / 2.0f);
+        m_position = position;
+        m_lifetime = sf::Time::Zero;
+        m_alpha = 255.0f;
+        m_scale = 1.0f;
+        m_active = true;
     }
 
     void FloatingScore::update(sf::Time deltaTime)
     {
+        if (!m_active)
+            return;
+
         m_lifetime += deltaTime;
+        if (m_lifetime >= m_maxLifetime)
+        {
+            m_active = false;
+            return;
+        }
 
         // Update position
-        m_text.move(m_velocity * deltaTime.asSeconds());
+        m_position.y += m_floatSpeed * deltaTime.asSeconds();
 
-        // Update alpha fade
+        // Fade out while growing
         float fadeProgress = m_lifetime.asSeconds() / m_maxLifetime.asSeconds();
         m_alpha = std::max(0.0f, 255.0f * (1.0f - fadeProgress));
-
-        sf::Color color = m_text.getFillColor();
-        color.a = static_cast<sf::Uint8>(m_alpha);
-        m_text.setFillColor(color);
-
-        sf::Color outlineColor = m_text.getOutlineColor();
-        outlineColor.a = static_cast<sf::Uint8>(m_alpha);
-        m_text.setOutlineColor(outlineColor);
-
-        // Scale effect
-        float scale = 1.0f + fadeProgress * 0.5f;
-        m_text.setScale(scale, scale);
-    }
-
-    void FloatingScore::draw(sf::RenderTarget& target, sf::RenderStates states) const
-    {
-        target.draw(m_text, states);
+        m_scale = 1.0f + fadeProgress * 0.5f;
     }
 
     // ScoreSystem implementation
@@ -93,7 +82,8 @@ namespace FishGame
         , m_floatingScores()
         , m_fishCounts()
     {
-        m_floatingScores.reserve(20);
+        std::for_each(m_vertices.begin(), m_vertices.end(),
+            [](std::vector<sf::Vertex>& vertices) { vertices.reserve(Constants::MAX_FLOATING_SCORES * verticesPerLabel); });
     }
 
     int ScoreSystem::calculateScore(ScoreEventType type, int basePoints, int frenzyMultiplier, float powerUpMultiplier)
@@ -146,41 +136,145 @@ namespace FishGame
 
     void ScoreSystem::update(sf::Time deltaTime)
     {
-        // Update floating scores
+        // Slots expire themselves; nothing is erased or freed
         std::for_each(m_floatingScores.begin(), m_floatingScores.end(),
-            [deltaTime](std::unique_ptr<FloatingScore>& score) {
-                score->update(deltaTime);
-            });
-
-        // Remove expired floating scores using erase-remove idiom
-        m_floatingScores.erase(
-            std::remove_if(m_floatingScores.begin(), m_floatingScores.end(),
-                [](const std::unique_ptr<FloatingScore>& score) {
-                    return score->isExpired();
-                }),
-            m_floatingScores.end()
-        );
+            [deltaTime](FloatingScore& score) { score.update(deltaTime); });
     }
 
-    void ScoreSystem::drawFloatingScores(sf::RenderTarget& target) const
+    void ScoreSystem::drawFloatingScores(DrawList& target) const
     {
+        const sf::FloatRect area = DrawUtils::visibleArea(target.getView(), Constants::RENDER_CULL_MARGIN);
+
+        std::for_each(m_vertices.begin(), m_vertices.end(),
+            [](std::vector<sf::Vertex>& vertices) { vertices.clear(); });
+
         std::for_each(m_floatingScores.begin(), m_floatingScores.end(),
-            [&target](const std::unique_ptr<FloatingScore>& score) {
-                target.draw(*score);
+            [this, &area](const FloatingScore& score) {
+                if (score.isActive() && area.contains(score.getPosition()))
+                    appendLabel(score, glyphsFor(score.getStyle()), m_vertices[score.getStyle()]);
             });
+
+        // One draw per label style, each from that size's glyph page
+        for (std::size_t style = 0; style < m_vertices.size(); ++style)
+        {
+            const std::vector<sf::Vertex>& vertices = m_vertices[style];
+            if (vertices.empty())
+                continue;
+
+            sf::RenderStates states;
+            states.texture = &m_font.getTexture(labelStyles[style].characterSize);
+            target.draw(vertices.data(), vertices.size(), sf::Triangles, states);
+        }
     }
 
     void ScoreSystem::reset()
     {
         m_currentScore = 0;
         m_currentChain = 0;
-        m_floatingScores.clear();
+        std::for_each(m_floatingScores.begin(), m_floatingScores.end(),
+            [](FloatingScore& score) { score.deactivate(); });
         m_fishCounts.clear();
     }
 
     void ScoreSystem::createFloatingScore(int points, int multiplier, sf::Vector2f position)
     {
-        auto floatingScore = std::make_unique<FloatingScore>(m_font, points, multiplier, position);
-        m_floatingScores.push_back(std::move(floatingScore));
+        auto slot = std::find_if(m_floatingScores.begin(), m_floatingScores.end(),
+            [](const FloatingScore& score) { return !score.isActive(); });
+
+        // Pool exhausted: recycle the label closest to fading out
+        if (slot == m_floatingScores.end())
+        {
+            slot = std::max_element(m_floatingScores.begin(), m_floatingScores.end(),
+                [](const FloatingScore& a, const FloatingScore& b) { return a.getLifetime() < b.getLifetime(); });
+        }
+
+        slot->spawn(points, multiplier, position);
+    }
+
+    const ScoreSystem::GlyphSet& ScoreSystem::glyphsFor(std::size_t style) const
+    {
+        // Looked up at draw time, since it may rasterize into the font page
+        GlyphSet& glyphs = m_glyphs[style];
+        if (!glyphs.loaded)
+        {
+            const LabelStyle& labelStyle = labelStyles[style];
+            for (std::size_t i = 0; i < m_glyphChars.size(); ++i)
+            {
+                const auto codePoint = static_cast<sf::Uint32>(m_glyphChars[i]);
+                glyphs.fill[i] = m_font.getGlyph(codePoint, labelStyle.characterSize, false);
+                glyphs.outline[i] = m_font.getGlyph(codePoint, labelStyle.characterSize, false,
+                    labelStyle.outlineThickness);
+            }
+            glyphs.loaded = true;
+        }
+        return glyphs;
+    }
+
+    void ScoreSystem::appendLabel(const FloatingScore& score, const GlyphSet& glyphs,
+        std::vector<sf::Vertex>& vertices) const
+    {
+        const std::string_view label = score.getLabel();
+
+        // Measure the label to center it on its position
+        float width = 0.0f;
+        float top = 0.0f;
+        float bottom = 0.0f;
+        for (char c : label)
+        {
+            const std::size_t index = m_glyphChars.find(c);
+            if (index == std::string_view::npos)
+                continue;
+
+            const sf::Glyph& glyph = glyphs.fill[index];
+            width += glyph.advance;
+            top = std::min(top, glyph.bounds.top);
+            bottom = std::max(bottom, glyph.bounds.top + glyph.bounds.height);
+        }
+
+        const sf::Vector2f center(width / 2.0f, (top + bottom) / 2.0f);
+        const sf::Vector2f position = score.getPosition();
+        const float scale = score.getScale();
+
+        auto appendQuads = [&](const std::array<sf::Glyph, m_glyphChars.size()>& set, sf::Color color)
+        {
+            color.a = score.getAlpha();
+            float pen = 0.0f;
+            for (char c : label)
+            {
+                const std::size_t index = m_glyphChars.find(c);
+                if (index == std::string_view::npos)
+                    continue;
+
+                const sf::Glyph& glyph = set[index];
+                if (glyph.textureRect.width > 0)
+                {
+                    const float left = pen + glyph.bounds.left - glyphPadding;
+                    const float right = pen + glyph.bounds.left + glyph.bounds.width + glyphPadding;
+                    const float upper = glyph.bounds.top - glyphPadding;
+                    const float lower = glyph.bounds.top + glyph.bounds.height + glyphPadding;
+
+                    const float u1 = static_cast<float>(glyph.textureRect.left) - glyphPadding;
+                    const float v1 = static_cast<float>(glyph.textureRect.top) - glyphPadding;
+                    const float u2 = static_cast<float>(glyph.textureRect.left + glyph.textureRect.width) + glyphPadding;
+                    const float v2 = static_cast<float>(glyph.textureRect.top + glyph.textureRect.height) + glyphPadding;
+
+                    auto corner = [&](float x, float y, float u, float v) {
+                        vertices.emplace_back(position + (sf::Vector2f(x, y) - center) * scale,
+                            color, sf::Vector2f(u, v));
+                    };
+                    corner(left, upper, u1, v1);
+                    corner(right, upper, u2, v1);
+                    corner(left, lower, u1, v2);
+                    corner(left, lower, u1, v2);
+                    corner(right, upper, u2, v1);
+                    corner(right, lower, u2, v2);
+                }
+                pen += glyphs.fill[index].advance;
+            }
+        };
+
+        // Outline first so the fill sits on top, as sf::Text draws it
+        appendQuads(glyphs.outline, sf::Color::Black);
+        appendQuads(glyphs.fill, labelStyles[score.getStyle()].color);
     }
 }
@@ -0,0 +1,87 @@
+#include "SpatialGrid.h"
+#include <cmath>
+
+namespace FishGame
+{
+    SpatialGrid::SpatialGrid(const sf::FloatRect& bounds, float cellSize)
+        : m_bounds(bounds)
+        , m_inverseCellSize(1.0f / cellSize)
+        , m_columns(std::max<std::size_t>(1, static_cast<std::size_t>(std::ceil(bounds.width / cellSize))))
+        , m_rows(std::max<std::size_t>(1, static_cast<std::size_t>(std::ceil(bounds.height / cellSize))))
+        , m_cellStart(m_columns * m_rows + 1, 0)
+        , m_cursor(m_columns * m_rows, 0)
+    {
+    }
+
+    void SpatialGrid::add(Entity& entity, std::uint32_t group, std::uint32_t index)
+    {
+        m_proxies.push_back({ &entity, entity.getPosition(), entity.getRadius(),
+                              entity.getCollisionCategory(), entity.getCollisionMask(),
+                              group, index, false });
+    }
+
+    void SpatialGrid::add(Entity& entity, const sf::Vector2f& center, float radius,
+                          std::uint32_t group, std::uint32_t index)
+    {
+        m_proxies.push_back({ &entity, center, radius,
+                              entity.getCollisionCategory(), entity.getCollisionMask(),
+                              group, index, true });
+    }
+
+    void SpatialGrid::build()
+    {
+        std::fill(m_cellStart.begin(), m_cellStart.end(), 0u);
+
+        // Count the cells each proxy's bounding box covers
+        for (const Proxy& proxy : m_proxies)
+        {
+            const CellRange range = cellRange(proxy.position, proxy.radius);
+            for (int y = range.minY; y <= range.maxY; ++y)
+                for (int x = range.minX; x <= range.maxX; ++x)
+                    ++m_cellStart[cellIndex(x, y) + 1];
+        }
+
+        for (std::size_t cell = 1; cell < m_cellStart.size(); ++cell)
+            m_cellStart[cell] += m_cellStart[cell - 1];
+
+        m_cellItems.resize(m_cellStart.back());
+        std::copy(m_cellStart.begin(), m_cellStart.end() - 1, m_cursor.begin());
+
+        for (std::uint32_t i = 0; i < m_proxies.size(); ++i)
+        {
+            const CellRange range = cellRange(m_proxies[i].position, m_proxies[i].radius);
+            for (int y = range.minY; y <= range.maxY; ++y)
+                for (int x = range.minX; x <= range.maxX; ++x)
+                    m_cellItems[m_cursor[cellIndex(x, y)]++] = i;
+        }
+
+        m_packedX.resize(m_cellItems.size());
+        m_packedY.resize(m_cellItems.size());
+        m_packedRadius.resize(m_cellItems.size());
+        for (std::size_t slot = 0; slot < m_cellItems.size(); ++slot)
+        {
+            const Proxy& proxy = m_proxies[m_cellItems[slot]];
+            m_packedX[slot] = proxy.position.x;
+            m_packedY[slot] = proxy.position.y;
+            m_packedRadius[slot] = proxy.radius;
+        }
+    }
+
+    int SpatialGrid::clampColumn(float x) const noexcept
+    {
+        const int column = static_cast<int>(std::floor((x - m_bounds.left) * m_inverseCellSize));
+        return std::clamp(column, 0, static_cast<int>(m_columns) - 1);
+    }
+
+    int SpatialGrid::clampRow(float y) const noexcept
+    {
+        const int row = static_cast<int>(std::floor((y - m_bounds.top) * m_inverseCellSize));
+        return std::clamp(row, 0, static_cast<int>(m_rows) - 1);
+    }
+
+    SpatialGrid::CellRange SpatialGrid::cellRange(const sf::Vector2f& center, float radius) const noexcept
+    {
+        return { clampColumn(center.x - radius), clampRow(center.y - radius),
+                 clampColumn(center.x + radius), clampRow(center.y + radius) };
+    }
+}
@@ -0,0 +1,97 @@
+#include "SpriteBatch.h"
+#include <algorithm>
+#include <cstdlib>
+
+namespace FishGame
+{
+    void SpriteBatch::clear()
+    {
+        std::for_each(m_batches.begin(), m_batches.end(),
+            [](Batch& batch) { batch.vertices.clear(); });
+        m_activeBatches = 0;
+        m_deferred.clear();
+        m_offset = {};
+    }
+
+    SpriteBatch::Batch& SpriteBatch::batchFor(const sf::Texture& texture, int layer)
+    {
+        const auto active = m_batches.begin() + static_cast<std::ptrdiff_t>(m_activeBatches);
+        auto it = std::find_if(m_batches.begin(), active,
+            [&texture, layer](const Batch& batch)
+            {
+                return batch.texture == &texture && batch.layer == layer;
+            });
+        if (it != active)
+            return *it;
+
+        // Reuse a retired batch's storage before growing
+        if (m_activeBatches == m_batches.size())
+            m_batches.push_back({ layer, &texture, sf::VertexArray(sf::Triangles) });
+
+        Batch& batch = m_batches[m_activeBatches++];
+        batch.layer = layer;
+        batch.texture = &texture;
+        batch.vertices.clear();
+        return batch;
+    }
+
+    void SpriteBatch::add(const sf::Sprite& sprite, int layer)
+    {
+        if (const sf::Texture* texture = sprite.getTexture())
+            add(*texture, sprite.getTextureRect(), sprite.getTransform(), sprite.getColor(), layer);
+    }
+
+    void SpriteBatch::add(const sf::Texture& texture, const sf::IntRect& textureRect,
+                          const sf::Transform& transform, const sf::Color& color, int layer)
+    {
+        const float width = static_cast<float>(std::abs(textureRect.width));
+        const float height = static_cast<float>(std::abs(textureRect.height));
+
+        const float left = static_cast<float>(textureRect.left);
+        const float right = left + static_cast<float>(textureRect.width);
+        const float top = static_cast<float>(textureRect.top);
+        const float bottom = top + static_cast<float>(textureRect.height);
+
+        sf::Transform placed = transform;
+        if (m_offset != sf::Vector2f())
+            placed = sf::Transform().translate(m_offset) * transform;
+
+        const sf::Vertex topLeft(placed.transformPoint(0.f, 0.f), color, sf::Vector2f(left, top));
+        const sf::Vertex topRight(placed.transformPoint(width, 0.f), color, sf::Vector2f(right, top));
+        const sf::Vertex bottomRight(placed.transformPoint(width, height), color, sf::Vector2f(right, bottom));
+        const sf::Vertex bottomLeft(placed.transformPoint(0.f, height), color, sf::Vector2f(left, bottom));
+
+        sf::VertexArray& vertices = batchFor(texture, layer).vertices;
+        vertices.append(topLeft);
+        vertices.append(topRight);
+        vertices.append(bottomRight);
+        vertices.append(topLeft);
+        vertices.append(bottomRight);
+        vertices.append(bottomLeft);
+    }
+
+    void SpriteBatch::draw(DrawList& target, sf::RenderStates states) const
+    {
+        // Lower layers first; within a layer, textures keep first-use order
+        m_order.clear();
+        std::for_each(m_batches.begin(), m_batches.begin() + static_cast<std::ptrdiff_t>(m_activeBatches),
+            [this](const Batch& batch) { m_order.push_back(&batch); });
+        std::stable_sort(m_order.begin(), m_order.end(),
+            [](const Batch* lhs, const Batch* rhs) { return lhs->layer < rhs->layer; });
+
+        std::for_each(m_order.begin(), m_order.end(),
+            [&target, states](const Batch* batch) mutable
+            {
+                states.texture = batch->texture;
+                target.draw(batch->vertices, states);
+            });
+
+        std::for_each(m_deferred.begin(), m_deferred.end(),
+            [&target, &states](const Deferred& entry)
+            {
+                sf::RenderStates placed = states;
+                placed.transform.translate(entry.offset);
+                target.draw(*entry.drawable, placed);
+            });
+    }
+}
@@ -44,6 +44,15 @@ namespace FishGame
         }
     }
 
+    template<typename OwnerType>
+    void SpriteComponent<OwnerType>::setTexture(const sf::Texture& texture, const sf::IntRect& region)
+    {
+        // Atlas regions replace the whole-texture default before centring
+        m_sprite.setTexture(texture);
+        m_sprite.setTextureRect(region);
+        setTexture(texture);
+    }
+
     template<typename OwnerType>
     void SpriteComponent<OwnerType>::configure(const SpriteConfig<OwnerType>& config)
     {
@@ -172,7 +181,7 @@ namespace FishGame
     }
 
     template<typename OwnerType>
-    void SpriteComponent<OwnerType>::draw(sf::RenderTarget& target, sf::RenderStates states) const
+    void SpriteComponent<OwnerType>::draw(DrawList& target, sf::RenderStates states) const
     {
         target.draw(m_sprite, states);
     }
@@ -24,8 +24,8 @@ namespace FishGame
             direction /= length;
         }
         float speed = 100.f;
-        if (auto* fish = dynamic_cast<Fish*>(&entity))
-            speed = fish->getSpeed();
+        if (isFishKind(entity.getKind()))
+            speed = static_cast<Fish&>(entity).getSpeed();
         entity.setVelocity(direction * speed);
         entity.updatePosition(deltaTime);
     }
@@ -45,8 +45,9 @@ namespace FishGame
         sf::Vector2f pos = entity.getPosition();
         sf::Vector2f velocity = entity.getVelocity();
 
-        if (auto* fish = dynamic_cast<Fish*>(&entity))
+        if (isFishKind(entity.getKind()))
         {
+            auto* fish = static_cast<Fish*>(&entity);
             speed = fish->getSpeed();
 
             const sf::Vector2u win = fish->getWindowBounds();
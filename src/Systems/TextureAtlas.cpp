@@ -0,0 +1,167 @@
+#include "TextureAtlas.h"
+#include "GameExceptions.h"
+#include <algorithm>
+#include <numeric>
+
+namespace FishGame
+{
+    TextureAtlas::TextureAtlas(unsigned int pageSize, unsigned int padding)
+        : m_pageSize(pageSize)
+        , m_padding(padding)
+    {
+    }
+
+    std::size_t TextureAtlas::add(sf::Image image)
+    {
+        m_images.push_back(std::move(image));
+        m_regions.push_back({ 0, {} });
+        return m_images.size() - 1;
+    }
+
+    bool TextureAtlas::findPosition(const PageLayout& page, int width, int height, sf::Vector2i& position)
+    {
+        bool found = false;
+        for (std::size_t i = 0; i < page.skyline.size(); ++i)
+        {
+            const int x = page.skyline[i].x;
+            if (x + width > page.width)
+                break;
+
+            // Resting height is the tallest node under the span
+            int y = 0;
+            int remaining = width;
+            for (std::size_t j = i; remaining > 0; ++j)
+            {
+                y = std::max(y, page.skyline[j].y);
+                remaining -= page.skyline[j].width;
+            }
+
+            if (y + height > page.height)
+                continue;
+
+            if (!found || y < position.y)
+            {
+                position = { x, y };
+                found = true;
+            }
+        }
+        return found;
+    }
+
+    void TextureAtlas::place(PageLayout& page, const sf::IntRect& rect)
+    {
+        auto& skyline = page.skyline;
+        auto it = std::find_if(skyline.begin(), skyline.end(),
+            [&rect](const SkylineNode& node) { return node.x == rect.left; });
+        it = skyline.insert(it, { rect.left, rect.top + rect.height, rect.width });
+
+        // Trim the nodes the new one now covers
+        const int right = rect.left + rect.width;
+        auto next = std::next(it);
+        while (next != skyline.end() && next->x < right)
+        {
+            const int overlap = right - next->x;
+            if (overlap < next->width)
+            {
+                next->x += overlap;
+                next->width -= overlap;
+                break;
+            }
+            next = skyline.erase(next);
+        }
+
+        // Merge neighbours left at the same height
+        for (std::size_t i = 1; i < skyline.size();)
+        {
+            if (skyline[i - 1].y == skyline[i].y)
+            {
+                skyline[i - 1].width += skyline[i].width;
+                skyline.erase(skyline.begin() + static_cast<std::ptrdiff_t>(i));
+            }
+            else
+            {
+                ++i;
+            }
+        }
+
+        page.usedWidth = std::max(page.usedWidth, right);
+        page.usedHeight = std::max(page.usedHeight, rect.top + rect.height);
+    }
+
+    void TextureAtlas::build()
+    {
+        // Tallest first keeps the skyline flat
+        std::vector<std::size_t> order(m_images.size());
+        std::iota(order.begin(), order.end(), std::size_t{ 0 });
+        std::stable_sort(order.begin(), order.end(),
+            [this](std::size_t lhs, std::size_t rhs)
+            {
+                return m_images[lhs].getSize().y > m_images[rhs].getSize().y;
+            });
+
+        const int pageSize = static_cast<int>(m_pageSize);
+        const int padding = static_cast<int>(m_padding);
+        std::vector<PageLayout> layouts;
+
+        std::for_each(order.begin(), order.end(), [&](std::size_t handle)
+            {
+                const sf::Vector2u size = m_images[handle].getSize();
+                const int width = static_cast<int>(size.x);
+                const int height = static_cast<int>(size.y);
+                const int paddedWidth = width + padding;
+                const int paddedHeight = height + padding;
+
+                sf::Vector2i position;
+                auto page = std::find_if(layouts.begin(), layouts.end(),
+                    [&](const PageLayout& layout)
+                    {
+                        return findPosition(layout, paddedWidth, paddedHeight, position);
+                    });
+
+                if (page == layouts.end())
+                {
+                    // Oversized images get an exactly fitting page
+                    const int pageWidth = std::max(pageSize, paddedWidth);
+                    const int pageHeight = std::max(pageSize, paddedHeight);
+                    layouts.push_back({ pageWidth, pageHeight, { { 0, 0, pageWidth } } });
+                    page = std::prev(layouts.end());
+                    position = { 0, 0 };
+                }
+
+                place(*page, { position.x, position.y, paddedWidth, paddedHeight });
+                m_regions[handle] = { static_cast<std::size_t>(page - layouts.begin()),
+                                      { position.x, position.y, width, height } };
+            });
+
+        std::vector<sf::Image> pageImages(layouts.size());
+        for (std::size_t i = 0; i < layouts.size(); ++i)
+        {
+            pageImages[i].create(static_cast<unsigned int>(layouts[i].usedWidth),
+                                 static_cast<unsigned int>(layouts[i].usedHeight),
+                                 sf::Color::Transparent);
+        }
+
+        for (std::size_t handle = 0; handle < m_images.size(); ++handle)
+        {
+            const Region& region = m_regions[handle];
+            pageImages[region.page].copy(m_images[handle],
+                                         static_cast<unsigned int>(region.rect.left),
+                                         static_cast<unsigned int>(region.rect.top));
+        }
+
+        m_pages.clear();
+        m_pages.reserve(pageImages.size());
+        std::for_each(pageImages.begin(), pageImages.end(), [this](const sf::Image& image)
+            {
+                auto texture = std::make_unique<sf::Texture>();
+                if (!texture->loadFromImage(image))
+                {
+                    throw ResourceLoadException("Failed to upload texture atlas page");
+                }
+                m_pages.push_back(std::move(texture));
+            });
+
+        m_images.clear();
+        m_images.shrink_to_fit();
+    }
+}
@@ -0,0 +1,64 @@
+#include "DebugOverlay.h"
+#include "GameConstants.h"
+#include <iomanip>
+#include <sstream>
+
+namespace FishGame
+{
+    namespace
+    {
+        const char* pacingName(PacingMode mode)
+        {
+            switch (mode)
+            {
+            case PacingMode::Limiter:   return "limiter";
+            case PacingMode::VSync:     return "vsync";
+            case PacingMode::Unlimited: return "unlimited";
+            }
+            return "";
+        }
+    }
+
+    DebugOverlay::DebugOverlay(const sf::Font& font)
+    {
+        m_text.setFont(font);
+        m_text.setCharacterSize(Constants::DEBUG_OVERLAY_FONT_SIZE);
+        m_text.setFillColor(sf::Color::White);
+        m_text.setPosition(Constants::HUD_MARGIN, Constants::HUD_MARGIN);
+
+        m_background.setFillColor(sf::Color(0, 0, 0, 160));
+        m_background.setPosition(Constants::HUD_MARGIN * 0.5f, Constants::HUD_MARGIN * 0.5f);
+
+        update({});
+    }
+
+    void DebugOverlay::update(const Readout& readout)
+    {
+        std::ostringstream stream;
+        stream << std::fixed << std::setprecision(1)
+            << "FPS " << readout.fps << "  tick " << readout.tickRate << " Hz  "
+            << pacingName(readout.pacing) << '\n'
+            << std::setprecision(2)
+            << "frame p50 " << readout.p50.asSeconds() * 1000.0f
+            << "  p95 " << readout.p95.asSeconds() * 1000.0f
+            << "  p99 " << readout.p99.asSeconds() * 1000.0f
+            << "  max " << readout.worst.asSeconds() * 1000.0f << " ms\n"
+            << "jitter (p99 - p50) " << (readout.p99 - readout.p50).asSeconds() * 1000.0f << " ms\n"
+            << "sim dropped " << readout.droppedTime.asSeconds() << " s  scale " << readout.timeScale << '\n'
+            << "input latency " << readout.inputLatency.asSeconds() * 1000.0f << " ms\n"
+            << "lazy glyph loads " << readout.lazyGlyphLoads;
+        m_text.setString(stream.str());
+
+        const sf::FloatRect bounds = m_text.getGlobalBounds();
+        m_background.setSize({ bounds.width + Constants::HUD_MARGIN, bounds.height + Constants::HUD_MARGIN });
+    }
+
+    void DebugOverlay::draw(sf::RenderTarget& target, sf::RenderStates states) const
+    {
+        if (!m_visible)
+            return;
+
+        target.draw(m_background, states);
+        target.draw(m_text, states);
+    }
+}
@@ -1,8 +1,7 @@
 #include "GrowthMeter.h"
 #include "GameConstants.h"
+#include "Utils/FixedString.h"
 #include <algorithm>
-#include <sstream>
-#include <iomanip>
 #include <array>
 #include <cmath>
 
@@ -49,7 +48,8 @@ namespace FishGame
         m_progressText.setCharacterSize(16);
         m_progressText.setFillColor(Constants::HUD_TEXT_COLOR);
 
-        updateVisuals();
+        updateFill();
+        updateProgressText();
     }
 
     void GrowthMeter::setPoints(int points)
@@ -75,7 +75,8 @@ namespace FishGame
             m_maxProgress = static_cast<float>(Constants::POINTS_TO_WIN - Constants::POINTS_FOR_STAGE_3);
         }
 
-        updateVisuals();
+        updateFill();
+        updateProgressText();
     }
 
     void GrowthMeter::update(sf::Time deltaTime)
@@ -84,7 +85,7 @@ namespace FishGame
         {
             float increment = m_fillSpeed * deltaTime.asSeconds();
             m_currentProgress = std::min(m_currentProgress + increment, m_targetProgress);
-            updateVisuals();
+            updateFill();
         }
 
         if (m_currentProgress / m_maxProgress > 0.8f && m_currentStage < 4)
@@ -94,7 +95,8 @@ namespace FishGame
             sf::Color fillColor = m_fillBar.getFillColor();
             fillColor.r = static_cast<sf::Uint8>(fillColor.r + (255 - fillColor.r) * m_glowIntensity * 0.3f);
             fillColor.g = static_cast<sf::Uint8>(fillColor.g + (255 - fillColor.g) * m_glowIntensity * 0.3f);
-            m_fillBar.setFillColor(fillColor);
+            if (fillColor != m_fillBar.getFillColor())
+                m_fillBar.setFillColor(fillColor);
         }
     }
 
@@ -104,7 +106,8 @@ namespace FishGame
         m_targetProgress = 0.0f;
         m_glowIntensity = 0.0f;
         m_points = 0;
-        updateVisuals();
+        updateFill();
+        updateProgressText();
     }
 
     void GrowthMeter::setPosition(float x, float y)
@@ -125,9 +128,9 @@ namespace FishGame
     {
         m_currentStage = std::clamp(stage, 1, Constants::MAX_STAGES);
 
-        std::ostringstream stageStream;
-        stageStream << "Stage " << m_currentStage;
-        m_stageText.setString(stageStream.str());
+        FixedString<16> stageText;
+        stageText << "Stage " << m_currentStage;
+        m_stageText.setString(stageText.c_str());
 
         const std::array<sf::Color, 3> stageColors{
             sf::Color(0, 255, 100),
@@ -140,7 +143,7 @@ namespace FishGame
         setPoints(m_points);
     }
 
-    void GrowthMeter::draw(sf::RenderTarget& target, sf::RenderStates states) const
+    void GrowthMeter::draw(DrawList& target, sf::RenderStates states) const
     {
         target.draw(m_background, states);
         target.draw(m_fillBar, states);
@@ -149,24 +152,37 @@ namespace FishGame
         target.draw(m_progressText, states);
     }
 
-    void GrowthMeter::updateVisuals()
+    void GrowthMeter::updateFill()
     {
         float fillPercentage = m_maxProgress > 0 ? m_currentProgress / m_maxProgress : 0.0f;
         float fillWidth = (m_width - m_borderThickness * 2) * fillPercentage;
         m_fillBar.setSize(sf::Vector2f(fillWidth, m_height - m_borderThickness * 2));
+    }
+
+    int GrowthMeter::getTargetPoints() const
+    {
+        switch (m_currentStage)
+        {
+        case 1:  return Constants::POINTS_FOR_STAGE_2;
+        case 2:  return Constants::POINTS_FOR_STAGE_3;
+        case 3:  return Constants::POINTS_TO_WIN;
+        default: return 0;
+        }
+    }
 
-        std::ostringstream progressStream;
+    void GrowthMeter::updateProgressText()
+    {
+        // Text layout is only redone when the numbers change
+        const int targetPoints = getTargetPoints();
+        if (m_points == m_shownPoints && targetPoints == m_shownTarget)
+            return;
 
-        int targetPoints = 0;
-        if (m_currentStage == 1)
-            targetPoints = Constants::POINTS_FOR_STAGE_2;
-        else if (m_currentStage == 2)
-            targetPoints = Constants::POINTS_FOR_STAGE_3;
-        else if (m_currentStage == 3)
-            targetPoints = Constants::POINTS_TO_WIN;
+        m_shownPoints = m_points;
+        m_shownTarget = targetPoints;
 
-        progressStream << "Points: " << m_points << "/" << targetPoints;
-        m_progressText.setString(progressStream.str());
+        FixedString<32> progressText;
+        progressText << "Points: " << m_points << '/' << targetPoints;
+        m_progressText.setString(progressText.c_str());
 
         sf::FloatRect progressBounds = m_progressText.getLocalBounds();
         m_progressText.setPosition(m_position.x + m_width - progressBounds.width - 5.0f,
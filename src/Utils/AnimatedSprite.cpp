@@ -1,14 +1,21 @@
 #include "AnimatedSprite.h"
+#include <algorithm>
 
-AnimatedSprite::AnimatedSprite(const sf::Texture& texture)
+AnimatedSprite::AnimatedSprite(const sf::Texture& texture, sf::Vector2i frameOffset)
     : m_texture(texture)
+    , m_frameOffset(frameOffset)
 {
     m_sprite.setTexture(texture);
 }
 
 void AnimatedSprite::addAnimation(const std::string& name, const Animation& anim)
 {
-    m_anims[name] = anim;
+    Animation& stored = m_anims[name] = anim;
+    std::for_each(stored.frames.begin(), stored.frames.end(), [this](sf::IntRect& frame)
+        {
+            frame.left += m_frameOffset.x;
+            frame.top += m_frameOffset.y;
+        });
 }
 
 void AnimatedSprite::play(const std::string& name)
@@ -56,7 +63,7 @@ void AnimatedSprite::setPosition(const sf::Vector2f& pos)
 }
 
 
-void AnimatedSprite::draw(sf::RenderTarget& target, sf::RenderStates states) const
+void AnimatedSprite::draw(FishGame::DrawList& target, sf::RenderStates states) const
 {
     target.draw(m_sprite, states);
 }
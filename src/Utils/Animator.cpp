@@ -3,8 +3,10 @@
 
 using namespace sf;
 
-Animator::Animator(const sf::Texture& texture, int frameWidth, int frameHeight, int startX)
+Animator::Animator(const sf::Texture& texture, int frameWidth, int frameHeight, int startX,
+    sf::Vector2i frameOffset)
     : m_texture(texture), m_startX(startX), m_frameW(frameWidth), m_frameH(frameHeight)
+    , m_frameOffset(frameOffset)
 {
     m_sprite.setTexture(m_texture);
 }
@@ -14,6 +16,11 @@ void Animator::addClip(const std::string& name, const std::vector<IntRect>& fram
 {
     Clip c;
     c.frames = frames;
+    std::for_each(c.frames.begin(), c.frames.end(), [this](IntRect& frame)
+        {
+            frame.left += m_frameOffset.x;
+            frame.top += m_frameOffset.y;
+        });
     c.frameTime = frameTime;
     c.loop = loop;
     c.flipped = flipped;
@@ -80,13 +87,16 @@ void Animator::play(const std::string& name)
 
 void Animator::update(Time dt)
 {
-    if (!m_current)
+    if (!m_current || m_current->frameTime <= Time::Zero)
         return;
 
+    // A large step (deferred by animation LOD) walks several frames
     m_elapsed += dt;
-    if (m_elapsed >= m_current->frameTime)
+    bool stepped = false;
+    while (m_elapsed >= m_current->frameTime)
     {
         m_elapsed -= m_current->frameTime;
+        stepped = true;
 
         if (m_current->pingPong)
         {
@@ -130,21 +140,22 @@ void Animator::update(Time dt)
                     m_index = m_current->frames.size() - 1;
             }
         }
+    }
 
+    if (stepped)
         m_sprite.setTextureRect(m_current->frames[m_index]);
-    }
 }
 
-void Animator::draw(RenderTarget& target, RenderStates states) const
+void Animator::draw(FishGame::DrawList& target, RenderStates states) const
 {
     target.draw(m_sprite, states);
 }
 
 // Factory helpers -------------------------------------------------
 
-Animator createFishAnimator(const sf::Texture& tex)
+Animator createFishAnimator(const sf::Texture& tex, sf::Vector2i frameOffset)
 {
-    Animator a(tex, 126, 102);
+    Animator a(tex, 126, 102, 1, frameOffset);
 
     auto makeClip = [&](const std::string& name, int rowY, int start, int count,
         Time dur, bool loop = true, bool reverse = false, bool ping = false)
@@ -170,9 +181,9 @@ Animator createFishAnimator(const sf::Texture& tex)
     return a;
 }
 
-Animator createBarracudaAnimator(const sf::Texture& tex)
+Animator createBarracudaAnimator(const sf::Texture& tex, sf::Vector2i frameOffset)
 {
-    Animator a(tex, 270, 122);
+    Animator a(tex, 270, 122, 1, frameOffset);
 
     auto makeClip = [&](const std::string& name, int rowY, int start, int count,
         Time dur, bool loop = true, bool reverse = false, bool ping = false)
@@ -195,9 +206,9 @@ Animator createBarracudaAnimator(const sf::Texture& tex)
     return a;
 }
 
-Animator createSimpleFishAnimator(const sf::Texture& tex)
+Animator createSimpleFishAnimator(const sf::Texture& tex, sf::Vector2i frameOffset)
 {
-    Animator a(tex, 66, 44);
+    Animator a(tex, 66, 44, 1, frameOffset);
 
     auto makeClip = [&](const std::string& name, int rowY, int start, int count,
         Time dur, bool loop = true, bool reverse = false, bool ping = false)
@@ -217,9 +228,9 @@ Animator createSimpleFishAnimator(const sf::Texture& tex)
     return a;
 }
 
-Animator createMediumFishAnimator(const sf::Texture& tex)
+Animator createMediumFishAnimator(const sf::Texture& tex, sf::Vector2i frameOffset)
 {
-    Animator a(tex, 172, 108);
+    Animator a(tex, 172, 108, 1, frameOffset);
 
     auto makeClip = [&](const std::string& name, int rowY, int start, int count,
         Time dur, bool loop = true, bool reverse = false, bool ping = false)
@@ -242,9 +253,9 @@ Animator createMediumFishAnimator(const sf::Texture& tex)
     return a;
 }
 
-Animator createPufferfishAnimator(const sf::Texture& tex)
+Animator createPufferfishAnimator(const sf::Texture& tex, sf::Vector2i frameOffset)
 {
-    Animator a(tex, 187, 123, 5);
+    Animator a(tex, 187, 123, 5, frameOffset);
 
     auto makeFrames = [](int rowY, int width, std::size_t count, int height)
         {
@@ -282,9 +293,9 @@ Animator createPufferfishAnimator(const sf::Texture& tex)
     return a;
 }
 
-Animator createLargeFishAnimator(const sf::Texture& tex)
+Animator createLargeFishAnimator(const sf::Texture& tex, sf::Vector2i frameOffset)
 {
-    Animator a(tex, 201, 148);
+    Animator a(tex, 201, 148, 1, frameOffset);
 
     auto makeClip = [&](const std::string& name, int rowY, int start, int count,
         Time dur, bool loop = true, bool reverse = false, bool ping = false)
@@ -0,0 +1,114 @@
+#include "CollisionSystem.h"
+#include "GenericFish.h"
+#include "Player.h"
+#include "PowerUp.h"
+#include "SoundPlayer.h"
+#include <iostream>
+#include <memory>
+#include <vector>
+
+namespace FishGame
+{
+    namespace
+    {
+        // One tick at the lowest supported rate
+        const sf::Time tick = sf::seconds(1.0f / 30.0f);
+
+        // Everything CollisionSystem reports into, with no window or state
+        struct Fixture
+        {
+            ParticleSystem particles;
+            sf::Font font;
+            ScoreSystem score{ font };
+            FrenzySystem frenzy{ font };
+            PowerUpManager powerUps;
+            std::unordered_map<TextureID, int> levelCounts;
+            SoundPlayer sounds;
+            bool playerStunned = false;
+            sf::Time stunTimer = sf::Time::Zero;
+            sf::Time controlReverseTimer = sf::Time::Zero;
+            int playerLives = Constants::INITIAL_LIVES;
+            int deaths = 0;
+
+            CollisionSystem collisions{ particles, score, frenzy, powerUps, levelCounts, sounds,
+                                        playerStunned, stunTimer, controlReverseTimer, playerLives,
+                                        [this]() { ++deaths; }, []() {}, []() {} };
+
+            std::vector<std::unique_ptr<Entity>> entities;
+            std::vector<std::unique_ptr<BonusItem>> bonusItems;
+            std::vector<std::unique_ptr<Hazard>> hazards;
+
+            Entity& addSmallFish(const sf::Vector2f& position)
+            {
+                auto fish = std::make_unique<SmallFish>();
+                fish->setPosition(position);
+                fish->setVelocity(0.f, 0.f);
+                entities.push_back(std::move(fish));
+                return *entities.back();
+            }
+
+            void process(Player& player)
+            {
+                collisions.process(player, entities, bonusItems, hazards, nullptr, 1, tick);
+            }
+        };
+
+        // Moves the player from `from` by `delta` within a single tick, facing
+        // the way it swims (the player starts out facing left)
+        void dash(Player& player, const sf::Vector2f& from, const sf::Vector2f& delta)
+        {
+            player.setPosition(from);
+            player.setVelocity(delta / tick.asSeconds());
+            player.updatePosition(tick);
+        }
+
+        int failures = 0;
+
+        void check(bool condition, const char* what)
+        {
+            if (!condition)
+            {
+                std::cerr << "FAILED: " << what << '\n';
+                ++failures;
+            }
+        }
+
+        void fastPlayerEatsFishItCrosses()
+        {
+            Fixture fixture;
+            Player player;
+
+            // 100 px in one tick: the player starts and ends clear of the
+            // fish, so only the swept path ever touches it
+            Entity& fish = fixture.addSmallFish({ 350.f, 300.f });
+            dash(player, { 400.f, 300.f }, { -100.f, 0.f });
+            fixture.process(player);
+
+            check(!fish.isAlive(), "fish crossed in one tick is eaten");
+            check(fixture.levelCounts[TextureID::SmallFish] == 1, "eaten fish is counted once");
+            check(fixture.deaths == 0, "crossing a smaller fish does not kill the player");
+        }
+
+        void fastPlayerMissesFishBesideItsPath()
+        {
+            Fixture fixture;
+            Player player;
+
+            Entity& fish = fixture.addSmallFish({ 350.f, 360.f });
+            dash(player, { 400.f, 300.f }, { -100.f, 0.f });
+            fixture.process(player);
+
+            check(fish.isAlive(), "fish beside the swept path survives");
+        }
+    }
+}
+
+int main()
+{
+    FishGame::fastPlayerEatsFishItCrosses();
+    FishGame::fastPlayerMissesFishBesideItsPath();
+
+    if (FishGame::failures == 0)
+        std::cout << "All collision tests passed\n";
+    return FishGame::failures == 0 ? 0 : 1;
+}